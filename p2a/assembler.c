@@ -7,42 +7,117 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include "lc2k.h"
 //Every LC2K file will contain less than 1000 lines of assembly.
 #define MAXLINELENGTH 1000
+//LC-2K has a 16-bit address space.
+#define MAXMEMORY 65536
+//Pseudo-instructions expand into many lines, at most one per word of memory.
+#define MAXLINES MAXMEMORY
 #define MAX_SYMBOLS 1000
-#define MAX_RELOCATIONS 1000
+//-relax can add two relocations per line on top of the line's own.
+#define MAX_RELOCATIONS (3 * MAXLINES)
+#define MAXFIELDLENGTH 32
+//Registers clobbered by pseudo-instructions and the sequences -relax generates.
+//A long branch writes its return address to RELAXLINKREG unless -linkreg
+//names another register.
+#define SCRATCHREG 6
+#define RELAXLINKREG 7
+//Rewrite rules for -O, as written by superopt. Unless -rules names another
+//file, this is read from the directory the assembler binary is in.
+#define RULESFILE "superopt.rules"
+#define MAXRULES 1000
+#define MAXRULELENGTH 16
 
 typedef struct {
-    char label[8];
-    char type;
+    LabelKey label; //0 for lines without one
     int address;
+    char type;
     char section;
 } LabelStruct;
 typedef struct {
-    char label[8];
-    char type;
+    LabelKey label;
     int address;
+    char type;
 } SymbolTableStruct;
 typedef struct {
     int section;
     int lineOffset;
-    char opcode[MAXLINELENGTH];
-    char label[8];
+    char opcode[8];
+    LabelKey label;
 } RelocationStruct;
-LabelStruct labels[MAX_SYMBOLS];
+//One source line kept from the first pass for the second pass.
+typedef struct {
+    char label[8];
+    char opcode[MAXFIELDLENGTH];
+    char arg0[MAXFIELDLENGTH];
+    char arg1[MAXFIELDLENGTH];
+    char arg2[MAXFIELDLENGTH];
+    int size; //words emitted into the text section (more than 1 once relaxed)
+} AsmLine;
+//add or nor in a rewrite rule; regs[] holds 0 for r0 or n for the rule's
+//nth register variable
+typedef struct {
+    int op;
+    int regs[3];
+} RuleInstruction;
+typedef struct {
+    RuleInstruction pattern[MAXRULELENGTH];
+    RuleInstruction replacement[MAXRULELENGTH];
+    int patternLength, replacementLength;
+} Rule;
+LabelStruct labels[MAXLINES];
 int numLabels = 0;
 SymbolTableStruct symbolTable[MAX_SYMBOLS];
 int numSymbols = 0;
 RelocationStruct relocationTable[MAX_RELOCATIONS];
 int numRelocations = 0;
-int textSection[MAXLINELENGTH];
-int dataSection[MAXLINELENGTH];
+int textSection[MAXMEMORY];
+int dataSection[MAXMEMORY];
 int numText = 0, numData = 0;
+AsmLine lines[MAXLINES];
+int lineAddress[MAXLINES]; //address of each line once text and data are laid out
+int numLines = 0;
+bool relaxMode = false;
+bool scheduleMode = false;
+bool optimizeMode = false;
+Rule rules[MAXRULES];
+int numRules = 0;
+int poolStart = 1; //the literal pool follows the beq over it at address 0
+int poolSize = 0; //words reserved for the pool, one per relaxed line
+int numPool = 0;
+int relaxLinkReg = RELAXLINKREG;
+int poolSection[MAXLINES];
 
 int readAndParse(FILE *, char *, char *, char *, char *, char *);
-int labelFinder(char *label);
-int symbolFinder(char *label);
-void addRelocation(int section, int lineOffset, char *opcode, char *label);
+LabelKey labelKey(char *label);
+int labelFinder(LabelKey label);
+int symbolFinder(LabelKey label);
+void addRelocation(int section, int lineOffset, char *opcode, LabelKey label);
+void addLine(char *label, char *opcode, char *arg0, char *arg1, char *arg2);
+void layoutLines(void);
+int relaxLines(void);
+int lineNeedsRelaxing(int lineIndex);
+int relaxedSize(AsmLine *line);
+int addPoolLoad(int textLine, int reg, int value, bool isAddress);
+int lineRegisters(AsmLine *line, int *defReg, int *useRegs, int *memAccess);
+int linesDepend(AsmLine *first, AsmLine *second);
+int loadUseStall(AsmLine *load, AsmLine *next);
+int countStalls(void);
+int scheduleLines(void);
+int isPseudo(char *opcode);
+void expandPseudo(char *label, char *opcode, char *arg0, char *arg1, char *arg2);
+void addInstruction(char *opcode, int regA, int regB, int destReg);
+int pseudoReg(char *arg);
+int pseudoValue(char *arg);
+void addMovi(int reg, int value);
+void addNegate(int regA, int destReg);
+int multiplySequence(int regA, unsigned int value, int destReg, bool signedDigits, bool emit);
+char *defaultRulesFile(char *program);
+void readRules(char *rulesFileStr);
+int parseRuleSide(char *side, RuleInstruction *instructions);
+int matchRule(Rule *rule, int start, int *binding);
+int optimizeLines(int *saved);
 static inline int isNumber(char *);
 static inline void printHexToFile(FILE *, int);
 static inline int validReg(char *);
@@ -55,14 +130,37 @@ int main(int argc, char **argv) {
     char label[8], opcode[MAXLINELENGTH], arg0[MAXLINELENGTH],
             arg1[MAXLINELENGTH], arg2[MAXLINELENGTH];
 
-    if (argc != 3) {
-        printf("error: usage: %s <assembly-code-file> <machine-code-file>\n",
+    char *rulesFileStr = NULL;
+    int argIndex = 1;
+    while (argIndex < argc && argv[argIndex][0] == '-') {
+        if (strcmp(argv[argIndex], "-relax") == 0) {
+            relaxMode = true;
+        } else if (strcmp(argv[argIndex], "-sched") == 0) {
+            scheduleMode = true;
+        } else if (strcmp(argv[argIndex], "-O") == 0) {
+            optimizeMode = true;
+        } else if (strcmp(argv[argIndex], "-rules") == 0 && argIndex + 1 < argc) {
+            rulesFileStr = argv[++argIndex];
+        } else if (strcmp(argv[argIndex], "-linkreg") == 0 && argIndex + 1 < argc) {
+            relaxLinkReg = atoi(argv[++argIndex]);
+            if (relaxLinkReg <= 0 || relaxLinkReg >= NUMREGS || relaxLinkReg == SCRATCHREG) {
+                printf("error: -linkreg must be a register from 1 to 7 other than %d\n",
+                    SCRATCHREG);
+                exit(1);
+            }
+        } else {
+            break;
+        }
+        argIndex++;
+    }
+    if (argc - argIndex != 2) {
+        printf("error: usage: %s [-relax [-linkreg <reg>]] [-sched] [-O] [-rules <rules-file>] <assembly-code-file> <machine-code-file>\n",
             argv[0]);
         exit(1);
     }
 
-    inFileStr = argv[1];
-    outFileStr = argv[2];
+    inFileStr = argv[argIndex];
+    outFileStr = argv[argIndex + 1];
 
     inFilePtr = fopen(inFileStr, "r");
     if (inFilePtr == NULL) {
@@ -82,11 +180,10 @@ int main(int argc, char **argv) {
     while (readAndParse(inFilePtr, label, opcode, arg0, arg1, arg2)) {// First pass
         if (opcode[0] =='\0') continue;
         if (label[0] != '\0') {
-            for (int i = 0; i < numLabels; i++) {
-                if (strcmp(labels[i].label, label) == 0) {
-                    printf("error: duplicate label %s\n", label);
-                    exit(1);
-                }
+            LabelKey key = labelKey(label);
+            if (labelFinder(key) != -1) {
+                printf("error: duplicate label %s\n", label);
+                exit(1);
             }
             char type;
             if (label[0] >= 'A' && label[0] <= 'Z') {
@@ -106,30 +203,62 @@ int main(int argc, char **argv) {
             } else {
                 address = numData;
             }
-            strcpy(labels[numLabels].label, label);
+            labels[numLabels].label = key;
             labels[numLabels].type = type;
             labels[numLabels].address = address;
             labels[numLabels].section = section;
             //numLabels++;
         }
+        if (isPseudo(opcode)) {
+            //expanded here so every address below is exact
+            int firstLine = numLines;
+            expandPseudo(label, opcode, arg0, arg1, arg2);
+            numText += numLines - firstLine;
+            numLabels += numLines - firstLine;
+            continue;
+        }
         if (strcmp(opcode, ".fill") == 0) {
             numData++;
         } else {
             numText++;
         }
         numLabels++;
+        addLine(label, opcode, arg0, arg1, arg2);
+    }
+    if (optimizeMode) {
+        int saved;
+        readRules(rulesFileStr != NULL ? rulesFileStr : defaultRulesFile(argv[0]));
+        int rewrites = optimizeLines(&saved);
+        printf("applied %d rewrites, saving %d instructions\n", rewrites, saved);
+    }
+    if (scheduleMode) {
+        int stalls = countStalls();
+        int removed = scheduleLines();
+        printf("scheduling removed %d of %d estimated load-use stalls\n", removed, stalls);
+    }
+    layoutLines();
+    int relaxed = 0;
+    if (relaxMode) {
+        relaxed = relaxLines();
     }
-    rewind(inFilePtr);
-    int address = 0;
     int textLine = 0, dataLine = 0; // Second pass (something is wrong in here)
-    while (readAndParse(inFilePtr, label,opcode, arg0, arg1, arg2)) {
-        if (opcode[0] == '\0') continue;
+    if (poolSize > 0) {//jump over the literal pool
+        textSection[textLine++] = encodeIType(OP_BEQ, 0, 0, poolSize);
+        textLine += poolSize;
+    }
+    for (int lineIndex = 0; lineIndex < numLines; lineIndex++) {
+        strcpy(label, lines[lineIndex].label);
+        strcpy(opcode, lines[lineIndex].opcode);
+        strcpy(arg0, lines[lineIndex].arg0);
+        strcpy(arg1, lines[lineIndex].arg1);
+        strcpy(arg2, lines[lineIndex].arg2);
         int regA, regB, destReg, offset = 0, mCode = 0;
+        LabelKey relocationLabel = 0;
 
         if (label[0] != '\0' && label[0]>= 'A' && label[0] <= 'Z') {
-            int symbolIndex = symbolFinder(label);
+            int symbolIndex = symbolFinder(labelKey(label));
             if (symbolIndex == -1) {
-                strcpy(symbolTable[numSymbols].label, label);
+                symbolTable[numSymbols].label = labelKey(label);
                 if (strcmp(opcode, ".fill") == 0) {
                     symbolTable[numSymbols].type = 'D';
                 } else {
@@ -158,7 +287,8 @@ int main(int argc, char **argv) {
             if (isNumber(arg0)) {
                 mCode = atoi(arg0);
             } else {
-                int labelIndex =labelFinder(arg0);
+                LabelKey key = packLabel(arg0);
+                int labelIndex =labelFinder(key);
                 if (labelIndex != -1) {
                     if (labels[labelIndex].type =='L') {
                         mCode = labels[labelIndex].address;
@@ -166,16 +296,9 @@ int main(int argc, char **argv) {
                             mCode += numText;
                         }
                     } else {
-                        
-                        for( int line=0; line<MAXLINELENGTH; line++)
-                            {
-                                if(strcmp(labels[line].label,arg0) == 0){
-                                    mCode = labelIndex;
-                                }
-                            }
-                        //mCode = 0;
-                        if (symbolFinder(arg0) == -1) {
-                            strcpy(symbolTable[numSymbols].label,arg0);
+                        mCode = lineAddress[labelIndex];
+                        if (symbolFinder(key) == -1) {
+                            symbolTable[numSymbols].label = key;
                             symbolTable[numSymbols].type ='U';
                             symbolTable[numSymbols].address = offset;
                             numSymbols++;
@@ -187,15 +310,16 @@ int main(int argc, char **argv) {
                         exit(1);
                     } else {
                         mCode = 0;
-                        if (symbolFinder(arg0)== -1) {
-                            strcpy(symbolTable[numSymbols].label, arg0);
+                        key = labelKey(arg0);
+                        if (symbolFinder(key)== -1) {
+                            symbolTable[numSymbols].label = key;
                             symbolTable[numSymbols].type = 'U';
                             symbolTable[numSymbols].address = 0;
                             numSymbols++;
                         }
                     }
                 }
-                addRelocation(1, dataLine, ".fill", arg0);
+                addRelocation(1, dataLine, ".fill", key);
             }
             dataSection[dataLine++] = mCode;
         } else {
@@ -209,11 +333,11 @@ int main(int argc, char **argv) {
                 destReg = atoi(arg2);
                 int op;
                 if (strcmp(opcode,"add") == 0) {
-                    op = 0;
+                    op = OP_ADD;
                 } else {
-                    op= 1;
+                    op = OP_NOR;
                 }
-                mCode = (op << 22) | (regA << 19)| (regB << 16) | destReg;
+                mCode = encodeRType(op, regA, regB, destReg);
             } else if (strcmp(opcode, "lw") == 0 || strcmp(opcode, "sw") == 0) {
                 if (!validReg(arg0) || !validReg(arg1)) {
                     printf("%s\n", "error: invalid reg number");
@@ -223,14 +347,15 @@ int main(int argc, char **argv) {
                 regB = atoi(arg1);
                 int op;
                 if (strcmp(opcode, "lw") == 0) {
-                    op = 2;
+                    op = OP_LW;
                 } else {
-                    op = 3;
+                    op = OP_SW;
                 }
                 if (isNumber(arg2)) {
                     offset = atoi(arg2);
                 } else {
-                    int labelIndex = labelFinder(arg2);
+                    LabelKey key = packLabel(arg2);
+                    int labelIndex = labelFinder(key);
                     if (labelIndex != -1) {
                         if (labels[labelIndex].type =='L') {
                             offset = labels[labelIndex].address;
@@ -238,14 +363,9 @@ int main(int argc, char **argv) {
                                 offset += numText;
                             }
                         } else {
-                            for( int line=0; line<MAXLINELENGTH; line++)
-                                {
-                                    if(strcmp(labels[line].label,arg2) == 0){
-                                        offset=line;
-                                    }
-                                }
-                            if (symbolFinder(arg2) == -1) {
-                                strcpy(symbolTable[numSymbols].label, arg2);
+                            offset = lineAddress[labelIndex];
+                            if (symbolFinder(key) == -1) {
+                                symbolTable[numSymbols].label = key;
                                 symbolTable[numSymbols].type = 'U';
                                 symbolTable[numSymbols].address = 0;
                                 numSymbols++;
@@ -257,21 +377,44 @@ int main(int argc, char **argv) {
                             exit(1);
                         } else {
                             offset = 0;
-                            if (symbolFinder(arg2) == -1) {
-                                strcpy(symbolTable[numSymbols].label, arg2);
+                            key = labelKey(arg2);
+                            if (symbolFinder(key) == -1) {
+                                symbolTable[numSymbols].label = key;
                                 symbolTable[numSymbols].type = 'U';
                                 symbolTable[numSymbols].address = 0;
                                 numSymbols++;
                             }
                         }
                     }
-                    addRelocation(0, textLine, opcode, arg2);
+                    relocationLabel = key;
+                }
+                if (lines[lineIndex].size > 1) {
+                    //Out-of-range constant or label address: load it from
+                    //the literal pool, form the address in a register and
+                    //use offset 0.
+                    int addrReg = SCRATCHREG;
+                    if (op == OP_LW && regB != regA && regB != 0) {
+                        addrReg = regB;
+                    } else if (regA == SCRATCHREG || (op == OP_SW && regB == SCRATCHREG)) {
+                        printf("error: register %d is reserved for relaxation\n", SCRATCHREG);
+                        exit(1);
+                    }
+                    textSection[textLine] = addPoolLoad(textLine, addrReg, offset,
+                        relocationLabel != 0);
+                    textLine++;
+                    if (regA != 0) {
+                        textSection[textLine++] = encodeRType(OP_ADD, addrReg, regA, addrReg);
+                    }
+                    regA = addrReg;
+                    offset = 0;
+                } else if (relocationLabel != 0) {
+                    addRelocation(0, textLine, opcode, relocationLabel);
                 }
                 if (offset < -32768|| offset > 32767) {
                     printf("%s\n", "error: offset not in range");
                     exit(1);
                 }
-                mCode = (op << 22) | (regA << 19) | (regB << 16) | (offset & 0xFFFF);
+                mCode = encodeIType(op, regA, regB, offset);
             } else if (strcmp(opcode, "beq") == 0) {
                 if (!validReg(arg0) || !validReg(arg1)) {
                     printf("%s\n", "error: invalid reg number");
@@ -282,9 +425,9 @@ int main(int argc, char **argv) {
                 if (isNumber(arg2)) {
                     offset = atoi(arg2);
                 } else {
-                    int labelIndex = labelFinder(arg2);
+                    int labelIndex = labelFinder(packLabel(arg2));
                     if (labelIndex != -1) {
-                       offset = labelIndex - address -1;
+                       offset = lineAddress[labelIndex] - textLine -1;
                     }
                         
                      else {
@@ -292,11 +435,25 @@ int main(int argc, char **argv) {
                         exit(1);
                     }
                 }
-                if (offset < -32768 || offset > 32767) {
-                    printf("%s\n", "error: offset not in range");
-                    exit(1);
+                if (lines[lineIndex].size > 1) {
+                    //Long branch: jump through an address in the literal pool.
+                    //Unless the branch is unconditional, test the condition
+                    //first and hop over the long jump when it fails.
+                    int target = textLine + 1 + offset;
+                    if (regA != regB) {
+                        textSection[textLine++] = encodeIType(OP_BEQ, regA, regB, 1);
+                        textSection[textLine++] = encodeIType(OP_BEQ, 0, 0, 2);
+                    }
+                    textSection[textLine] = addPoolLoad(textLine, SCRATCHREG, target, true);
+                    textLine++;
+                    mCode = encodeRType(OP_JALR, SCRATCHREG, relaxLinkReg, 0);
+                } else {
+                    if (offset < -32768 || offset > 32767) {
+                        printf("%s\n", "error: offset not in range");
+                        exit(1);
+                    }
+                    mCode = encodeIType(OP_BEQ, regA, regB, offset);
                 }
-                mCode = (4 << 22) | (regA << 19) | (regB << 16) | (offset & 0xFFFF);
             } else if (strcmp(opcode, "jalr") == 0) {
                 if (!validReg(arg0) || !validReg(arg1)) {
                     printf("%s\n", "error: invalid reg number");
@@ -304,21 +461,26 @@ int main(int argc, char **argv) {
                 }
                 regA = atoi(arg0);
                 regB = atoi(arg1);
-                mCode = (5 << 22) |(regA << 19) | (regB << 16);
+                mCode = encodeRType(OP_JALR, regA, regB, 0);
             } else if (strcmp(opcode, "halt") == 0) {
-                mCode = (6 << 22);
+                mCode = encodeRType(OP_HALT, 0, 0, 0);
             } else if (strcmp(opcode,"noop") == 0) {
-                mCode = (7 << 22);
+                mCode = encodeRType(OP_NOOP, 0, 0, 0);
             } else {
                 printf("%s\n", "error: unrecognized opcode");
                 exit(1);
             }
             
             textSection[textLine++] = mCode;
-            address++;
         }
         
     }
+    for (int i = 0; i < numPool; i++) {
+        textSection[poolStart + i] = poolSection[i];
+    }
+    if (relaxMode) {
+        printf("relaxed %d out-of-range instructions\n", relaxed);
+    }
 
     fprintf(outFilePtr, "%d %d %d %d\n", numText, numData, numSymbols, numRelocations);
     for (int i = 0; i < numText; i++) {
@@ -328,12 +490,13 @@ int main(int argc, char **argv) {
         printHexToFile(outFilePtr, dataSection[i]);
     }
     for (int i = 0; i < numSymbols; i++) {//symbol table
-        fprintf(outFilePtr, "%s %c %d\n", symbolTable[i].label, symbolTable[i].type, symbolTable[i].address);
+        unpackLabel(symbolTable[i].label, label);
+        fprintf(outFilePtr, "%s %c %d\n", label, symbolTable[i].type, symbolTable[i].address);
     }
     for (int i= 0; i < numRelocations; i++) {//relocaton table
         int lineOffset = relocationTable[i].lineOffset;
         char *opcode = relocationTable[i].opcode;
-        char *label = relocationTable[i].label;
+        unpackLabel(relocationTable[i].label, label);
         fprintf(outFilePtr, "%d %s %s\n", lineOffset, opcode, label);
     }
 
@@ -342,18 +505,30 @@ int main(int argc, char **argv) {
     return 0;
 }
 
-int symbolFinder(char *label) {//findin symbol in table
+LabelKey labelKey(char *label) {//packing a label read from the source
+    LabelKey key = packLabel(label);
+    if (key == 0) {
+        printf("error: label %s is longer than %d characters\n", label, MAXLABELLENGTH);
+        exit(1);
+    }
+    return key;
+}
+
+int symbolFinder(LabelKey label) {//findin symbol in table
     for (int i = 0; i < numSymbols; i++) {
-        if (strcmp(symbolTable[i].label, label) == 0) {
+        if (symbolTable[i].label == label) {
             return i;
         }
     }
     return -1;
 }
 
-int labelFinder(char *label) {//finding label in labels array
+int labelFinder(LabelKey label) {//finding label in labels array
+    if (label == 0) {
+        return -1;//too long to be defined; lines without a label are 0 too
+    }
     for (int i = 0; i < numLabels; i++) {
-        if (strcmp(labels[i].label, label) == 0) {
+        if (labels[i].label == label) {
             return i;
         }
     }
@@ -361,14 +536,768 @@ int labelFinder(char *label) {//finding label in labels array
 }
 
 
-void addRelocation(int section,int lineOffset, char *opcode, char *label) {//adding relocation entry
+void addRelocation(int section,int lineOffset, char *opcode, LabelKey label) {//adding relocation entry
+    if (numRelocations >= MAX_RELOCATIONS) {
+        printf("error: too many relocations\n");
+        exit(1);
+    }
     relocationTable[numRelocations].section = section;
     relocationTable[numRelocations].lineOffset = lineOffset;
     strcpy(relocationTable[numRelocations].opcode, opcode);
-    strcpy(relocationTable[numRelocations].label, label);
+    relocationTable[numRelocations].label = label;
     numRelocations++;
 }
 
+void addLine(char *label, char *opcode, char *arg0, char *arg1, char *arg2) {//keeping a line for the second pass
+    if (numLines >= MAXLINES) {
+        printf("error: too many lines\n");
+        exit(1);
+    }
+    if (strlen(opcode) >= MAXFIELDLENGTH || strlen(arg0) >= MAXFIELDLENGTH
+            || strlen(arg1) >= MAXFIELDLENGTH || strlen(arg2) >= MAXFIELDLENGTH) {
+        printf("error: field too long\n");
+        exit(1);
+    }
+    strcpy(lines[numLines].label, label);
+    strcpy(lines[numLines].opcode, opcode);
+    strcpy(lines[numLines].arg0, arg0);
+    strcpy(lines[numLines].arg1, arg1);
+    strcpy(lines[numLines].arg2, arg2);
+    lines[numLines].size = 1;
+    numLines++;
+}
+
+// Assigns every line its address from the current line sizes. Once a line
+// is relaxed, the text starts with a beq over the literal pool, so "lw 0"
+// reaches the pool however large the program is. The instructions follow,
+// then the .fill data, wherever the .fill lines sit in the source. Also
+// updates numText and the text label addresses to match.
+void layoutLines(void) {
+    int dataIndex = 0;
+    poolSize = 0;
+    for (int i = 0; i < numLines; i++) {
+        if (lines[i].size > 1) {
+            poolSize++;
+        }
+    }
+    int textAddress = poolSize > 0 ? poolStart + poolSize : 0;
+    for (int i = 0; i < numLines; i++) {
+        if (strcmp(lines[i].opcode, ".fill") != 0) {
+            lineAddress[i] = textAddress;
+            labels[i].address = textAddress;
+            textAddress += lines[i].size;
+        }
+    }
+    numText = textAddress;
+    for (int i = 0; i < numLines; i++) {
+        if (strcmp(lines[i].opcode, ".fill") == 0) {
+            lineAddress[i] = numText + dataIndex++;
+        }
+    }
+}
+
+// Returns the number of words a relaxed lw, sw or beq expands into.
+int relaxedSize(AsmLine *line) {
+    int regA = atoi(line->arg0);
+    if (strcmp(line->opcode, "beq") == 0) {
+        return regA == atoi(line->arg1) ? 2 : 4;
+    }
+    return regA == 0 ? 2 : 3;
+}
+
+// Returns non-zero if the line's immediate does not fit in 16 bits at its
+// current address. Labels defined in other files are left to the linker.
+int lineNeedsRelaxing(int lineIndex) {
+    AsmLine *line = &lines[lineIndex];
+    if (strcmp(line->opcode, "lw") == 0 || strcmp(line->opcode, "sw") == 0) {
+        int offset;
+        if (isNumber(line->arg2)) {
+            offset = atoi(line->arg2);
+        } else {
+            int labelIndex = labelFinder(packLabel(line->arg2));
+            if (labelIndex == -1) {
+                return 0;
+            }
+            offset = lineAddress[labelIndex];
+        }
+        return offset < -32768 || offset > 32767;
+    }
+    if (strcmp(line->opcode, "beq") == 0) {
+        int offset;
+        if (isNumber(line->arg2)) {
+            offset = atoi(line->arg2);
+        } else {
+            int labelIndex = labelFinder(packLabel(line->arg2));
+            if (labelIndex == -1) {
+                return 0;//reported in the second pass
+            }
+            offset = lineAddress[labelIndex] - lineAddress[lineIndex] - 1;
+        }
+        return offset < -32768 || offset > 32767;
+    }
+    return 0;
+}
+
+// Grows out-of-range instructions into literal pool sequences, redoing the
+// layout until no more lines grow. Lines only ever grow, so this converges.
+// A long branch overwrites relaxLinkReg, so the program must not read it.
+// Returns the number of relaxed instructions.
+int relaxLines(void) {
+    int relaxed = 0, changed = 1, longBranches = 0;
+    while (changed) {
+        changed = 0;
+        for (int i = 0; i < numLines; i++) {
+            if (lines[i].size == 1 && lineNeedsRelaxing(i)) {
+                lines[i].size = relaxedSize(&lines[i]);
+                relaxed++;
+                changed = 1;
+            }
+        }
+        layoutLines();
+    }
+    if (numText > MAXMEMORY) {
+        printf("error: program does not fit in memory\n");
+        exit(1);
+    }
+    for (int i = 0; i < numLines; i++) {
+        if (lines[i].size > 1 && strcmp(lines[i].opcode, "beq") == 0) {
+            longBranches++;
+        }
+    }
+    for (int i = 0; i < numLines && longBranches > 0; i++) {
+        int defReg, useRegs[2], memAccess;
+        lineRegisters(&lines[i], &defReg, useRegs, &memAccess);
+        if (useRegs[0] == relaxLinkReg || useRegs[1] == relaxLinkReg) {
+            printf("error: a long branch overwrites r%d, which the program reads; "
+                "pick a free register with -linkreg\n", relaxLinkReg);
+            exit(1);
+        }
+    }
+    return relaxed;
+}
+
+// Adds a literal pool word and returns the "lw 0 reg" that loads it from
+// textLine. A pool word holding an address in this file gets a ".pool"
+// relocation, which the linker applies to the whole word.
+int addPoolLoad(int textLine, int reg, int value, bool isAddress) {
+    char poolLabel[8];
+    int poolAddress = poolStart + numPool;
+    if (poolAddress > 32767) {
+        printf("%s\n", "error: literal pool too large");
+        exit(1);
+    }
+    sprintf(poolLabel, "_%d", numPool);
+    addRelocation(0, textLine, "lw", packLabel(poolLabel));
+    if (isAddress) {
+        addRelocation(0, poolAddress, ".pool", packLabel(poolLabel));
+    }
+    poolSection[numPool++] = value;
+    return encodeIType(OP_LW, 0, reg, poolAddress);
+}
+
+// Fills in the register written, the registers read and whether the line
+// loads (1) or stores (2) memory. Returns 0 for lines the scheduler must not
+// move (bad registers, unknown opcodes).
+int lineRegisters(AsmLine *line, int *defReg, int *useRegs, int *memAccess) {
+    int numUses = 0;
+    *defReg = -1;
+    *memAccess = 0;
+    useRegs[0] = useRegs[1] = -1;
+    if (strcmp(line->opcode, "halt") == 0 || strcmp(line->opcode, "noop") == 0) {
+        return 1;
+    }
+    if (!validReg(line->arg0) || !validReg(line->arg1)) {
+        return 0;
+    }
+    int regA = atoi(line->arg0);
+    int regB = atoi(line->arg1);
+    if (strcmp(line->opcode, "add") == 0 || strcmp(line->opcode, "nor") == 0) {
+        if (!validReg(line->arg2)) {
+            return 0;
+        }
+        useRegs[numUses++] = regA;
+        useRegs[numUses++] = regB;
+        *defReg = atoi(line->arg2);
+    } else if (strcmp(line->opcode, "lw") == 0) {
+        useRegs[numUses++] = regA;
+        *defReg = regB;
+        *memAccess = 1;
+    } else if (strcmp(line->opcode, "sw") == 0) {
+        useRegs[numUses++] = regA;
+        useRegs[numUses++] = regB;
+        *memAccess = 2;
+    } else if (strcmp(line->opcode, "beq") == 0) {
+        useRegs[numUses++] = regA;
+        useRegs[numUses++] = regB;
+    } else if (strcmp(line->opcode, "jalr") == 0) {
+        useRegs[numUses++] = regA;
+        *defReg = regB;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+// Returns non-zero if second has to stay after first: a register is read
+// after it is written, written after it is read or written twice, or a
+// store is involved in two memory accesses.
+int linesDepend(AsmLine *first, AsmLine *second) {
+    int def1, def2, uses1[2], uses2[2], mem1, mem2;
+    lineRegisters(first, &def1, uses1, &mem1);
+    lineRegisters(second, &def2, uses2, &mem2);
+    for (int i = 0; i < 2; i++) {
+        if (def1 != -1 && uses2[i] == def1) {
+            return 1;
+        }
+        if (def2 != -1 && uses1[i] == def2) {
+            return 1;
+        }
+    }
+    if (def1 != -1 && def1 == def2) {
+        return 1;
+    }
+    return (mem1 == 2 && mem2 != 0) || (mem2 == 2 && mem1 != 0);
+}
+
+// Returns non-zero if next reads the register that the lw before it loads,
+// which stalls the pipeline for a cycle.
+int loadUseStall(AsmLine *load, AsmLine *next) {
+    int loadDef, loadUses[2], loadMem, def, uses[2], mem;
+    if (strcmp(load->opcode, "lw") != 0 || !lineRegisters(load, &loadDef, loadUses, &loadMem)
+            || !lineRegisters(next, &def, uses, &mem)) {
+        return 0;
+    }
+    return uses[0] == loadDef || uses[1] == loadDef;
+}
+
+// Returns the number of load-use stalls in the text section, in line order.
+int countStalls(void) {
+    int stalls = 0;
+    AsmLine *prev = NULL;
+    for (int i = 0; i < numLines; i++) {
+        if (strcmp(lines[i].opcode, ".fill") == 0) {
+            continue;
+        }
+        if (prev != NULL && loadUseStall(prev, &lines[i])) {
+            stalls++;
+        }
+        prev = &lines[i];
+    }
+    return stalls;
+}
+
+// Reorders independent instructions inside each basic block so that the
+// instruction after an lw does not read its result. A block starts at a
+// label or a numeric beq target and ends after beq, jalr or halt, which stay
+// last. Labels stay where they are, so every address the rest of the
+// assembler computes is unchanged. Returns the number of stalls removed.
+int scheduleLines(void) {
+    static bool leader[MAXLINES];
+    static int textIndex[MAXLINES];
+    static AsmLine block[MAXLINES];
+    static bool placed[MAXLINES];
+    int numTextLines = 0;
+    for (int i = 0; i < numLines; i++) {
+        textIndex[i] = numTextLines;
+        if (strcmp(lines[i].opcode, ".fill") != 0) {
+            numTextLines++;
+        }
+        leader[i] = lines[i].label[0] != '\0';
+    }
+    for (int i = 0; i < numLines; i++) {
+        if (strcmp(lines[i].opcode, "beq") == 0 && isNumber(lines[i].arg2)) {
+            int target = textIndex[i] + 1 + atoi(lines[i].arg2);
+            for (int j = 0; j < numLines; j++) {
+                if (textIndex[j] == target && strcmp(lines[j].opcode, ".fill") != 0) {
+                    leader[j] = true;
+                }
+            }
+        }
+    }
+
+    int stalls = countStalls();
+    int start = 0;
+    while (start < numLines) {
+        //Find the block [start, end) and the lines that may move, [start, last).
+        int end = start, def, uses[2], mem;
+        bool movable = true;
+        while (end < numLines && strcmp(lines[end].opcode, ".fill") != 0
+                && (end == start || !leader[end])) {
+            movable = movable && lineRegisters(&lines[end], &def, uses, &mem);
+            end++;
+            if (strcmp(lines[end - 1].opcode, "beq") == 0 || strcmp(lines[end - 1].opcode, "jalr") == 0
+                    || strcmp(lines[end - 1].opcode, "halt") == 0) {
+                break;
+            }
+        }
+        if (end == start) {
+            start++;//.fill line
+            continue;
+        }
+        int last = end;
+        if (strcmp(lines[end - 1].opcode, "beq") == 0 || strcmp(lines[end - 1].opcode, "jalr") == 0
+                || strcmp(lines[end - 1].opcode, "halt") == 0) {
+            last = end - 1;
+        }
+        if (!movable || last - start < 2) {
+            start = end;
+            continue;
+        }
+
+        //Greedy list scheduling: take the first ready line that does not read
+        //what the previous lw loaded, or the first ready line if none.
+        AsmLine *prev = start > 0 ? &lines[start - 1] : NULL;
+        for (int i = start; i < last; i++) {
+            placed[i] = false;
+        }
+        for (int n = 0; n < last - start; n++) {
+            int choice = -1;
+            for (int i = start; i < last; i++) {
+                if (placed[i]) {
+                    continue;
+                }
+                bool ready = true;
+                for (int j = start; j < i && ready; j++) {
+                    if (!placed[j] && linesDepend(&lines[j], &lines[i])) {
+                        ready = false;
+                    }
+                }
+                if (!ready) {
+                    continue;
+                }
+                if (choice == -1) {
+                    choice = i;
+                }
+                if (prev == NULL || !loadUseStall(prev, &lines[i])) {
+                    choice = i;
+                    break;
+                }
+            }
+            placed[choice] = true;
+            block[n] = lines[choice];
+            prev = &block[n];
+        }
+
+        //Keep the new order only if it has fewer stalls, counting the lines
+        //on either side of the block.
+        int oldStalls = 0, newStalls = 0;
+        for (int i = start; i <= last && i < numLines; i++) {
+            if (i > 0 && strcmp(lines[i - 1].opcode, ".fill") != 0 && strcmp(lines[i].opcode, ".fill") != 0) {
+                oldStalls += loadUseStall(&lines[i - 1], &lines[i]);
+            }
+        }
+        for (int n = 0; n <= last - start && start + n < numLines; n++) {
+            AsmLine *line = n < last - start ? &block[n] : &lines[last];
+            AsmLine *above = n > 0 ? &block[n - 1] : (start > 0 ? &lines[start - 1] : NULL);
+            if (above != NULL && strcmp(above->opcode, ".fill") != 0 && strcmp(line->opcode, ".fill") != 0) {
+                newStalls += loadUseStall(above, line);
+            }
+        }
+        if (newStalls < oldStalls) {
+            char blockLabel[8];
+            strcpy(blockLabel, lines[start].label);
+            for (int n = 0; n < last - start; n++) {
+                lines[start + n] = block[n];
+                lines[start + n].label[0] = '\0';
+            }
+            strcpy(lines[start].label, blockLabel);
+        }
+        start = end;
+    }
+    return stalls - countStalls();
+}
+
+// Returns non-zero for the pseudo-instructions expanded in the first pass:
+//     movi reg value           reg = value
+//     neg regA destReg         destReg = -regA
+//     sub regA regB destReg    destReg = regA - regB
+//     shli regA amount destReg destReg = regA << amount
+//     muli regA value destReg  destReg = regA * value
+// Expansions that need a second register use SCRATCHREG.
+int isPseudo(char *opcode) {
+    return strcmp(opcode, "movi") == 0 || strcmp(opcode, "neg") == 0
+        || strcmp(opcode, "sub") == 0 || strcmp(opcode, "shli") == 0
+        || strcmp(opcode, "muli") == 0;
+}
+
+// Adds the add/nor lines for one pseudo-instruction. The label goes on the
+// first line.
+void expandPseudo(char *label, char *opcode, char *arg0, char *arg1, char *arg2) {
+    int firstLine = numLines;
+    if (strcmp(opcode, "movi") == 0) {
+        addMovi(pseudoReg(arg0), pseudoValue(arg1));
+    } else if (strcmp(opcode, "neg") == 0) {
+        addNegate(pseudoReg(arg0), pseudoReg(arg1));
+    } else if (strcmp(opcode, "sub") == 0) {
+        int regA = pseudoReg(arg0), regB = pseudoReg(arg1), destReg = pseudoReg(arg2);
+        //regA - regB == ~(~regA + regB)
+        if (regA == regB) {
+            addInstruction("add", 0, 0, destReg);
+        } else if (destReg != regB) {
+            addInstruction("nor", regA, regA, destReg);
+            addInstruction("add", destReg, regB, destReg);
+            addInstruction("nor", destReg, destReg, destReg);
+        } else {
+            if (regA == SCRATCHREG || regB == SCRATCHREG) {
+                printf("error: register %d is reserved for pseudo-instructions\n", SCRATCHREG);
+                exit(1);
+            }
+            addInstruction("nor", regA, regA, SCRATCHREG);
+            addInstruction("add", SCRATCHREG, regB, destReg);
+            addInstruction("nor", destReg, destReg, destReg);
+        }
+    } else if (strcmp(opcode, "shli") == 0) {
+        int regA = pseudoReg(arg0), amount = pseudoValue(arg1), destReg = pseudoReg(arg2);
+        if (amount < 0) {
+            printf("error: invalid shift amount %s\n", arg1);
+            exit(1);
+        }
+        if (amount == 0) {
+            addInstruction("add", regA, 0, destReg);
+        } else if (amount >= 32) {
+            addInstruction("add", 0, 0, destReg);
+        } else {
+            addInstruction("add", regA, regA, destReg);
+            for (int i = 1; i < amount; i++) {
+                addInstruction("add", destReg, destReg, destReg);
+            }
+        }
+    } else {
+        int regA = pseudoReg(arg0), value = pseudoValue(arg1), destReg = pseudoReg(arg2);
+        //Multiply by |value| with whichever digit set is shorter, then negate.
+        unsigned int magnitude = value < 0 ? -(unsigned int)value : (unsigned int)value;
+        bool signedDigits = multiplySequence(regA, magnitude, destReg, true, false)
+            < multiplySequence(regA, magnitude, destReg, false, false);
+        multiplySequence(regA, magnitude, destReg, signedDigits, true);
+        if (value < 0) {
+            addNegate(destReg, destReg);
+        }
+    }
+    strcpy(lines[firstLine].label, label);
+}
+
+void addInstruction(char *opcode, int regA, int regB, int destReg) {//adding an expanded line
+    char arg0[MAXFIELDLENGTH], arg1[MAXFIELDLENGTH], arg2[MAXFIELDLENGTH];
+    sprintf(arg0, "%d", regA);
+    sprintf(arg1, "%d", regB);
+    sprintf(arg2, "%d", destReg);
+    addLine("", opcode, arg0, arg1, arg2);
+}
+
+int pseudoReg(char *arg) {//register operand of a pseudo-instruction
+    if (!validReg(arg)) {
+        printf("%s\n", "error: invalid reg number");
+        exit(1);
+    }
+    return atoi(arg);
+}
+
+int pseudoValue(char *arg) {//numeric operand of a pseudo-instruction
+    if (!isNumber(arg)) {
+        printf("error: invalid immediate %s\n", arg);
+        exit(1);
+    }
+    return atoi(arg);
+}
+
+// Builds a constant with add and nor only. Appending a bit to x is a
+// doubling; doubling ~x instead gives ~(2x + 1), so 1 bits are appended
+// while the register holds the complement and 0 bits while it holds the
+// value, with a "nor reg reg reg" at each switch.
+void addMovi(int reg, int value) {
+    bool inverted = value < 0;//negative values are built as ~value
+    unsigned int bits = inverted ? ~(unsigned int)value : (unsigned int)value;
+    if (bits == 0) {
+        addInstruction(inverted ? "nor" : "add", 0, 0, reg);
+        return;
+    }
+    bool wantInverted = inverted;
+    int top = 31;
+    while (!(bits >> top & 1)) {
+        top--;
+    }
+    addInstruction("nor", 0, 0, reg);//complement of 0, ready for the top 1 bit
+    inverted = true;
+    for (int bit = top; bit >= 0; bit--) {
+        bool one = bits >> bit & 1;
+        if (one != inverted) {
+            addInstruction("nor", reg, reg, reg);
+            inverted = !inverted;
+        }
+        addInstruction("add", reg, reg, reg);
+    }
+    if (inverted != wantInverted) {
+        addInstruction("nor", reg, reg, reg);
+    }
+}
+
+// destReg = -regA, as ~(regA + -1).
+void addNegate(int regA, int destReg) {
+    int minusOne = destReg;
+    if (regA == destReg) {
+        if (regA == SCRATCHREG) {
+            printf("error: register %d is reserved for pseudo-instructions\n", SCRATCHREG);
+            exit(1);
+        }
+        minusOne = SCRATCHREG;
+    }
+    addInstruction("nor", 0, 0, minusOne);
+    addInstruction("add", regA, minusOne, destReg);
+    addInstruction("nor", destReg, destReg, destReg);
+}
+
+// destReg = regA * value by shift-and-add from the top digit down. With
+// signedDigits the multiplier is recoded into non-adjacent form, where a -1
+// digit costs a subtraction (three instructions) but long runs of 1 bits
+// collapse. Returns the number of instructions, adding them only if emit.
+int multiplySequence(int regA, unsigned int value, int destReg, bool signedDigits, bool emit) {
+    int digits[33], numDigits = 0, count = 0;
+    if (value <= 1) {
+        if (emit) {
+            addInstruction("add", value == 1 ? regA : 0, 0, destReg);
+        }
+        return 1;
+    }
+    //digits[] from least significant, value fits since its top digit is 1
+    unsigned long long rest = value;
+    while (rest != 0) {
+        int digit = 0;
+        if (rest & 1) {
+            digit = 1;
+            if (signedDigits && (rest & 3) == 3) {
+                digit = -1;
+            }
+        }
+        digits[numDigits++] = digit;
+        rest = (rest - digit) >> 1;
+    }
+    bool needsSource = false;//does anything after the top digit add regA again?
+    for (int i = numDigits - 2; i >= 0; i--) {
+        needsSource = needsSource || digits[i] != 0;
+    }
+    int source = regA;
+    if (needsSource && regA == destReg) {
+        if (regA == SCRATCHREG) {
+            printf("error: register %d is reserved for pseudo-instructions\n", SCRATCHREG);
+            exit(1);
+        }
+        source = SCRATCHREG;
+        count++;
+        if (emit) {
+            addInstruction("add", regA, 0, source);
+        }
+    }
+    for (int i = numDigits - 2; i >= 0; i--) {
+        count++;
+        if (emit) {
+            if (i == numDigits - 2) {
+                addInstruction("add", source, source, destReg);
+            } else {
+                addInstruction("add", destReg, destReg, destReg);
+            }
+        }
+        if (digits[i] == 1) {
+            count++;
+            if (emit) {
+                addInstruction("add", destReg, source, destReg);
+            }
+        } else if (digits[i] == -1) {
+            //destReg - source == ~(~destReg + source)
+            count += 3;
+            if (emit) {
+                addInstruction("nor", destReg, destReg, destReg);
+                addInstruction("add", destReg, source, destReg);
+                addInstruction("nor", destReg, destReg, destReg);
+            }
+        }
+    }
+    return count;
+}
+
+// Returns RULESFILE in the directory of the assembler binary, found from how
+// it was run. A bare command name was found through PATH, so fall back to the
+// current directory then.
+char *defaultRulesFile(char *program) {
+    static char path[MAXLINELENGTH];
+    char *slash = strrchr(program, '/');
+    if (slash == NULL || slash - program + 1 + strlen(RULESFILE) >= sizeof(path)) {
+        return RULESFILE;
+    }
+    sprintf(path, "%.*s%s", (int)(slash - program + 1), program, RULESFILE);
+    return path;
+}
+
+// Reads "pattern => replacement" lines, each side a ';'-separated list of
+// add/nor instructions over r0 and register variables a, b, c...
+void readRules(char *rulesFileStr) {
+    char line[MAXLINELENGTH];
+    FILE *rulesFilePtr = fopen(rulesFileStr, "r");
+    if (rulesFilePtr == NULL) {
+        printf("error in opening %s\n", rulesFileStr);
+        exit(1);
+    }
+    while (fgets(line, MAXLINELENGTH, rulesFilePtr) != NULL) {
+        if (lineIsBlank(line) || line[0] == '#') {
+            continue;
+        }
+        char *arrow = strstr(line, "=>");
+        if (arrow == NULL || numRules == MAXRULES) {
+            printf("error: bad rule %s", line);
+            exit(1);
+        }
+        *arrow = '\0';
+        Rule *rule = &rules[numRules];
+        rule->patternLength = parseRuleSide(line, rule->pattern);
+        rule->replacementLength = parseRuleSide(arrow + 2, rule->replacement);
+        if (rule->patternLength <= 0 || rule->replacementLength < 0
+                || rule->replacementLength >= rule->patternLength) {
+            printf("error: bad rule %s=>%s", line, arrow + 2);
+            exit(1);
+        }
+        numRules++;
+    }
+    fclose(rulesFilePtr);
+}
+
+// Returns the number of instructions on one side of a rule, or -1.
+int parseRuleSide(char *side, RuleInstruction *instructions) {
+    int count = 0;
+    for (char *part = strtok(side, ";"); part != NULL; part = strtok(NULL, ";")) {
+        char opcode[MAXLINELENGTH], regs[3][MAXLINELENGTH];
+        if (lineIsBlank(part)) {
+            continue;
+        }
+        if (count == MAXRULELENGTH
+                || sscanf(part, "%s %s %s %s", opcode, regs[0], regs[1], regs[2]) != 4) {
+            return -1;
+        }
+        instructions[count].op = opcodeNumber(opcode);
+        if (instructions[count].op != OP_ADD && instructions[count].op != OP_NOR) {
+            return -1;
+        }
+        for (int i = 0; i < 3; i++) {
+            if (strcmp(regs[i], "0") == 0) {
+                instructions[count].regs[i] = 0;
+            } else if (regs[i][0] >= 'a' && regs[i][0] < 'a' + NUMREGS - 1 && regs[i][1] == '\0') {
+                instructions[count].regs[i] = regs[i][0] - 'a' + 1;
+            } else {
+                return -1;
+            }
+        }
+        count++;
+    }
+    return count;
+}
+
+// Returns non-zero if the add/nor lines at start match the rule's pattern,
+// with binding[n] set to the register for variable n. Variables bind to
+// distinct registers other than r0, as superopt checked them.
+int matchRule(Rule *rule, int start, int *binding) {
+    bool taken[NUMREGS] = {true};
+    for (int n = 0; n < NUMREGS; n++) {
+        binding[n] = n == 0 ? 0 : -1;
+    }
+    if (start + rule->patternLength > numLines) {
+        return 0;
+    }
+    for (int i = 0; i < rule->patternLength; i++) {
+        AsmLine *line = &lines[start + i];
+        RuleInstruction *instruction = &rule->pattern[i];
+        if ((i > 0 && line->label[0] != '\0') || opcodeNumber(line->opcode) != instruction->op
+                || !validReg(line->arg0) || !validReg(line->arg1) || !validReg(line->arg2)) {
+            return 0;
+        }
+        int regs[3] = {atoi(line->arg0), atoi(line->arg1), atoi(line->arg2)};
+        for (int j = 0; j < 3; j++) {
+            int var = instruction->regs[j];
+            if (binding[var] == -1) {
+                if (taken[regs[j]]) {
+                    return 0;
+                }
+                binding[var] = regs[j];
+                taken[regs[j]] = true;
+            } else if (binding[var] != regs[j]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+// Applies the rules to every window of add/nor lines until none match,
+// deleting the lines each rewrite saves. Windows between a numeric beq and
+// its target are left alone since the offset counts lines. Returns the
+// number of rewrites.
+int optimizeLines(int *saved) {
+    static bool pinned[MAXLINES];
+    int textIndex = 0, rewrites = 0;
+    *saved = 0;
+    for (int i = 0; i < numLines; i++) {
+        pinned[i] = false;
+    }
+    for (int i = 0; i < numLines; i++) {
+        if (strcmp(lines[i].opcode, "beq") == 0 && isNumber(lines[i].arg2)) {
+            //the span in text lines, converted back to line indices
+            int target = textIndex + 1 + atoi(lines[i].arg2);
+            int low = target < textIndex ? target : textIndex;
+            int high = target < textIndex ? textIndex : target;
+            for (int j = 0, text = 0; j < numLines; j++) {
+                if (text >= low && text <= high) {
+                    pinned[j] = true;
+                }
+                if (strcmp(lines[j].opcode, ".fill") != 0) {
+                    text++;
+                }
+            }
+        }
+        if (strcmp(lines[i].opcode, ".fill") != 0) {
+            textIndex++;
+        }
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int start = 0; start < numLines; start++) {
+            for (int r = 0; r < numRules; r++) {
+                Rule *rule = &rules[r];
+                int binding[NUMREGS];
+                bool unpinned = true;
+                for (int i = start; i < start + rule->patternLength && i < numLines; i++) {
+                    unpinned = unpinned && !pinned[i];
+                }
+                if (!unpinned || !matchRule(rule, start, binding)
+                        || (rule->replacementLength == 0 && lines[start].label[0] != '\0')) {
+                    continue;
+                }
+                for (int i = 0; i < rule->replacementLength; i++) {
+                    RuleInstruction *instruction = &rule->replacement[i];
+                    AsmLine *line = &lines[start + i];
+                    strcpy(line->opcode, instruction->op == OP_ADD ? "add" : "nor");
+                    sprintf(line->arg0, "%d", binding[instruction->regs[0]]);
+                    sprintf(line->arg1, "%d", binding[instruction->regs[1]]);
+                    sprintf(line->arg2, "%d", binding[instruction->regs[2]]);
+                }
+                //lines[] and labels[] are both indexed by line
+                int removed = rule->patternLength - rule->replacementLength;
+                int from = start + rule->replacementLength;
+                for (int i = from; i + removed < numLines; i++) {
+                    lines[i] = lines[i + removed];
+                    labels[i] = labels[i + removed];
+                    pinned[i] = pinned[i + removed];
+                }
+                numLines -= removed;
+                numLabels -= removed;
+                numText -= removed;
+                *saved += removed;
+                rewrites++;
+                changed = true;
+            }
+        }
+    }
+    return rewrites;
+}
+
 // Returns non-zero if the line contains only whitespace.
 static int lineIsBlank(char *line) {
     char whitespace[4] = {'\t', '\n', '\r', ' '};
@@ -0,0 +1,103 @@
+/**
+ * Project 2a
+ * LC-2K instruction encoding and labels, shared by the assembler, the
+ * superoptimizer and the linker
+ */
+#ifndef LC2K_H
+#define LC2K_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define NUMREGS 8
+
+enum {
+    OP_ADD = 0,
+    OP_NOR = 1,
+    OP_LW = 2,
+    OP_SW = 3,
+    OP_BEQ = 4,
+    OP_JALR = 5,
+    OP_HALT = 6,
+    OP_NOOP = 7
+};
+
+// Returns the opcode number of an instruction mnemonic, or -1.
+static inline int
+opcodeNumber(const char *opcode)
+{
+    static const char *names[] = {"add", "nor", "lw", "sw", "beq", "jalr", "halt", "noop"};
+    for (int op = 0; op < 8; op++) {
+        if (strcmp(opcode, names[op]) == 0) {
+            return op;
+        }
+    }
+    return -1;
+}
+
+// add, nor (and jalr, halt, noop with unused fields set to 0)
+static inline int
+encodeRType(int op, int regA, int regB, int destReg)
+{
+    return (op << 22) | (regA << 19) | (regB << 16) | destReg;
+}
+
+// lw, sw, beq
+static inline int
+encodeIType(int op, int regA, int regB, int offset)
+{
+    return (op << 22) | (regA << 19) | (regB << 16) | (offset & 0xFFFF);
+}
+
+static inline int wordOpcode(int word) { return (word >> 22) & 7; }
+static inline int wordRegA(int word) { return (word >> 19) & 7; }
+static inline int wordRegB(int word) { return (word >> 16) & 7; }
+static inline int wordDestReg(int word) { return word & 7; }
+
+// Executes an add or nor word on reg[]. Anything else leaves reg[] alone.
+static inline void
+executeRType(int word, int *reg)
+{
+    int regA = reg[wordRegA(word)], regB = reg[wordRegB(word)];
+    if (wordOpcode(word) == OP_ADD) {
+        reg[wordDestReg(word)] = (int)((unsigned int)regA + (unsigned int)regB);
+    } else if (wordOpcode(word) == OP_NOR) {
+        reg[wordDestReg(word)] = ~(regA | regB);
+    }
+}
+
+// Labels have at most 6 characters, so a label packs into one integer: its
+// bytes zero-padded in the low 48 bits and its length in the top byte.
+// Comparing or hashing labels is then an integer operation; the text form
+// is only needed to read and write files.
+typedef uint64_t LabelKey;
+#define MAXLABELLENGTH 6
+
+// Returns the key of label, or 0 if it is empty or too long.
+static inline LabelKey
+packLabel(const char *label)
+{
+    LabelKey key = 0;
+    unsigned int length = 0;
+    for (; label[length] != '\0'; length++) {
+        if (length == MAXLABELLENGTH) {
+            return 0;
+        }
+        key |= (LabelKey)(unsigned char)label[length] << (8 * length);
+    }
+    return key | (LabelKey)length << 56;
+}
+
+// Writes the text of key into label, which has room for MAXLABELLENGTH + 1.
+static inline char *
+unpackLabel(LabelKey key, char *label)
+{
+    unsigned int length = (unsigned int)(key >> 56);
+    for (unsigned int i = 0; i < length; i++) {
+        label[i] = (char)(key >> (8 * i));
+    }
+    label[length] = '\0';
+    return label;
+}
+
+#endif
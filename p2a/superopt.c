@@ -0,0 +1,450 @@
+/**
+ * Project 2a
+ * Superoptimizer for straight-line LC-2K snippets
+ *
+ * Searches every add/nor sequence shorter than the snippet, shortest first,
+ * for one that leaves all 8 registers the way the snippet does. A match is
+ * appended to the rule file that "assembler -O" applies.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lc2k.h"
+
+#define MAXLINELENGTH 1000
+#define MAXSNIPPET 16
+#define MAXSEARCHLENGTH 8
+#define MAXCANDIDATES (2 * NUMREGS * NUMREGS * NUMREGS)
+//Quick filter every candidate is run against
+#define NUMVECTORS 16
+#define RULESFILE "superopt.rules"
+
+int snippet[MAXSNIPPET];
+int snippetLength = 0;
+int searchLimit = 5;
+int numThreads = 0;
+bool usedReg[NUMREGS], writtenReg[NUMREGS];
+//every add/nor word the search may use, in a fixed order
+int candidates[MAXCANDIDATES];
+int numCandidates = 0;
+int vectors[NUMVECTORS][NUMREGS];
+int expected[NUMVECTORS][NUMREGS];
+
+//shared by the workers searching one length
+pthread_mutex_t searchLock = PTHREAD_MUTEX_INITIALIZER;
+int nextFirst = 0;
+int bestFirst = 0;
+int bestSequence[MAXSEARCHLENGTH];
+
+typedef struct {
+    int length;
+    int sequence[MAXSEARCHLENGTH];
+    int state[MAXSEARCHLENGTH + 1][NUMVECTORS][NUMREGS];
+} Search;
+
+static void readSnippet(char *);
+static void buildCandidates(void);
+static void buildVectors(void);
+static void run(int *, int, int *);
+static uint32_t nextRandom(uint32_t *);
+static bool fullCheck(int *, int);
+static bool searchFrom(Search *, int);
+static void *searchWorker(void *);
+static void printSequence(FILE *, int *, int, char *);
+static void addRule(char *, int *, int);
+
+int main(int argc, char **argv) {
+    char *rulesFileStr = RULESFILE;
+    int argIndex = 1;
+    while (argIndex < argc && argv[argIndex][0] == '-') {
+        if (strcmp(argv[argIndex], "-j") == 0 && argIndex + 1 < argc) {
+            numThreads = atoi(argv[++argIndex]);
+        } else if (strcmp(argv[argIndex], "-l") == 0 && argIndex + 1 < argc) {
+            searchLimit = atoi(argv[++argIndex]);
+        } else {
+            break;
+        }
+        argIndex++;
+    }
+    if (argc - argIndex < 1 || argc - argIndex > 2) {
+        printf("error: usage: %s [-j threads] [-l max-length] <snippet-file> [rules-file]\n",
+            argv[0]);
+        exit(1);
+    }
+    if (argc - argIndex == 2) {
+        rulesFileStr = argv[argIndex + 1];
+    }
+    if (searchLimit > MAXSEARCHLENGTH) {
+        searchLimit = MAXSEARCHLENGTH;
+    }
+    if (numThreads <= 0) {
+        numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        if (numThreads <= 0) {
+            numThreads = 1;
+        }
+    }
+
+    readSnippet(argv[argIndex]);
+    buildCandidates();
+    buildVectors();
+
+    for (int length = 1; length < snippetLength && length <= searchLimit; length++) {
+        nextFirst = 0;
+        bestFirst = numCandidates;
+        pthread_t threads[numThreads];
+        for (int i = 0; i < numThreads; i++) {
+            Search *search = malloc(sizeof(Search));
+            if (search == NULL) {
+                printf("error: out of memory\n");
+                exit(1);
+            }
+            search->length = length;
+            if (pthread_create(&threads[i], NULL, searchWorker, search) != 0) {
+                printf("error: could not start a thread\n");
+                exit(1);
+            }
+        }
+        for (int i = 0; i < numThreads; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        if (bestFirst < numCandidates) {
+            printf("found %d-instruction replacement for %d instructions:\n", length, snippetLength);
+            printSequence(stdout, bestSequence, length, "\n");
+            addRule(rulesFileStr, bestSequence, length);
+            return 0;
+        }
+        printf("no %d-instruction replacement\n", length);
+    }
+    printf("no shorter sequence found\n");
+    return 0;
+}
+
+// Reads add/nor lines (no labels) and records which registers they read
+// and write.
+static void readSnippet(char *inFileStr) {
+    char line[MAXLINELENGTH], opcode[MAXLINELENGTH], arg0[MAXLINELENGTH],
+        arg1[MAXLINELENGTH], arg2[MAXLINELENGTH];
+    FILE *inFilePtr = fopen(inFileStr, "r");
+    if (inFilePtr == NULL) {
+        printf("error in opening %s\n", inFileStr);
+        exit(1);
+    }
+    usedReg[0] = true;
+    while (fgets(line, MAXLINELENGTH, inFilePtr) != NULL) {
+        if (sscanf(line, "%s", opcode) != 1) {
+            continue;
+        }
+        int op = opcodeNumber(opcode);
+        if (op != OP_ADD && op != OP_NOR) {
+            printf("error: snippet may only use add and nor: %s", line);
+            exit(1);
+        }
+        int regA, regB, destReg;
+        if (sscanf(line, "%s %s %s %s", opcode, arg0, arg1, arg2) != 4
+                || sscanf(arg0, "%d", &regA) != 1 || sscanf(arg1, "%d", &regB) != 1
+                || sscanf(arg2, "%d", &destReg) != 1
+                || regA < 0 || regA >= NUMREGS || regB < 0 || regB >= NUMREGS
+                || destReg <= 0 || destReg >= NUMREGS) {
+            printf("error: invalid reg number: %s", line);
+            exit(1);
+        }
+        if (snippetLength == MAXSNIPPET) {
+            printf("error: snippet longer than %d instructions\n", MAXSNIPPET);
+            exit(1);
+        }
+        snippet[snippetLength++] = encodeRType(op, regA, regB, destReg);
+        usedReg[regA] = usedReg[regB] = usedReg[destReg] = true;
+        writtenReg[destReg] = true;
+    }
+    fclose(inFilePtr);
+}
+
+// Candidates read registers the snippet uses and write only registers it
+// writes; anything else would change the final state. add and nor are
+// commutative, so regA <= regB.
+static void buildCandidates(void) {
+    for (int op = OP_ADD; op <= OP_NOR; op++) {
+        for (int regA = 0; regA < NUMREGS; regA++) {
+            for (int regB = regA; regB < NUMREGS; regB++) {
+                for (int destReg = 1; destReg < NUMREGS; destReg++) {
+                    if (usedReg[regA] && usedReg[regB] && writtenReg[destReg]) {
+                        candidates[numCandidates++] = encodeRType(op, regA, regB, destReg);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static uint32_t nextRandom(uint32_t *seed) {//xorshift32
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *seed = x;
+}
+
+static void buildVectors(void) {
+    uint32_t seed = 370;
+    for (int i = 0; i < NUMVECTORS; i++) {
+        vectors[i][0] = 0;
+        for (int reg = 1; reg < NUMREGS; reg++) {
+            vectors[i][reg] = (int)nextRandom(&seed);
+        }
+        memcpy(expected[i], vectors[i], sizeof(expected[i]));
+        run(snippet, snippetLength, expected[i]);
+    }
+}
+
+static void run(int *words, int length, int *reg) {
+    for (int i = 0; i < length; i++) {
+        executeRType(words[i], reg);
+    }
+}
+
+// add and nor compute bit k of their result from bit k of their inputs and
+// a carry, so a sequence can be run one bit position at a time, lowest bit
+// first. bits holds one bit of every register; bit i of carry is the carry
+// out of the i-th add.
+static void runBit(int *words, int length, int *bits, uint32_t *carry) {
+    int adds = 0;
+    for (int i = 0; i < length; i++) {
+        int a = *bits >> wordRegA(words[i]) & 1, b = *bits >> wordRegB(words[i]) & 1;
+        int result;
+        if (wordOpcode(words[i]) == OP_ADD) {
+            int c = *carry >> adds & 1;
+            result = a ^ b ^ c;
+            *carry = (*carry & ~(1u << adds)) | (uint32_t)((a & b) | (c & (a ^ b))) << adds;
+            adds++;
+        } else {
+            result = !(a | b);
+        }
+        *bits = (*bits & ~(1 << wordDestReg(words[i]))) | result << wordDestReg(words[i]);
+    }
+}
+
+static int countAdds(int *words, int length) {
+    int adds = 0;
+    for (int i = 0; i < length; i++) {
+        adds += wordOpcode(words[i]) == OP_ADD;
+    }
+    return adds;
+}
+
+// Proves the sequence leaves all 8 registers the way the snippet does for
+// every register state. Run bit-serially side by side, the two only differ in
+// their carries, so this walks every pair of carries reachable in the 32 bit
+// positions and checks each one against every value of the live register
+// bits at that position.
+static bool fullCheck(int *sequence, int length) {
+    int live[NUMREGS], numLive = 0;
+    for (int reg = 1; reg < NUMREGS; reg++) {
+        if (usedReg[reg]) {
+            live[numLive++] = reg;
+        }
+    }
+    int snippetAdds = countAdds(snippet, snippetLength);
+    int numAdds = snippetAdds + countAdds(sequence, length);
+    uint8_t *seen = calloc(((size_t)1 << numAdds) / 8 + 1, 1);
+    size_t capacity = 64, numStates = 1;
+    uint32_t *states = malloc(capacity * sizeof(uint32_t));
+    if (seen == NULL || states == NULL) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+    states[0] = 0;
+    seen[0] = 1;
+    bool equal = true;
+    size_t levelStart = 0;
+    for (int bit = 0; bit < 32 && equal; bit++) {
+        size_t levelEnd = numStates;
+        for (size_t i = levelStart; i < levelEnd && equal; i++) {
+            for (int input = 0; input < 1 << numLive; input++) {
+                int snippetBits = 0;
+                for (int j = 0; j < numLive; j++) {
+                    snippetBits |= (input >> j & 1) << live[j];
+                }
+                int sequenceBits = snippetBits;
+                uint32_t snippetCarry = states[i] & ((1u << snippetAdds) - 1);
+                uint32_t sequenceCarry = states[i] >> snippetAdds;
+                runBit(snippet, snippetLength, &snippetBits, &snippetCarry);
+                runBit(sequence, length, &sequenceBits, &sequenceCarry);
+                if (snippetBits != sequenceBits) {
+                    equal = false;
+                    break;
+                }
+                uint32_t next = snippetCarry | sequenceCarry << snippetAdds;
+                if (!(seen[next / 8] & 1 << next % 8)) {
+                    seen[next / 8] |= 1 << next % 8;
+                    if (numStates == capacity) {
+                        capacity *= 2;
+                        states = realloc(states, capacity * sizeof(uint32_t));
+                        if (states == NULL) {
+                            printf("error: out of memory\n");
+                            exit(1);
+                        }
+                    }
+                    states[numStates++] = next;
+                }
+            }
+        }
+        levelStart = levelEnd;
+    }
+    free(seen);
+    free(states);
+    return equal;
+}
+
+// Depth-first search for search->length instructions. Prunes instructions
+// that change nothing, writes that the next instruction overwrites unread,
+// and states with more wrong registers than instructions left.
+static bool searchFrom(Search *search, int depth) {
+    if (depth == search->length) {
+        for (int v = 0; v < NUMVECTORS; v++) {
+            if (memcmp(search->state[depth][v], expected[v], sizeof(expected[v])) != 0) {
+                return false;
+            }
+        }
+        return fullCheck(search->sequence, search->length);
+    }
+    int wrong = 0;
+    for (int reg = 1; reg < NUMREGS; reg++) {
+        for (int v = 0; v < NUMVECTORS; v++) {
+            if (search->state[depth][v][reg] != expected[v][reg]) {
+                wrong++;
+                break;
+            }
+        }
+    }
+    if (wrong > search->length - depth) {
+        return false;
+    }
+    int prev = depth > 0 ? search->sequence[depth - 1] : -1;
+    for (int c = 0; c < numCandidates; c++) {
+        int word = candidates[c];
+        if (prev != -1 && wordDestReg(prev) == wordDestReg(word)
+                && wordRegA(word) != wordDestReg(prev) && wordRegB(word) != wordDestReg(prev)) {
+            continue;
+        }
+        bool changed = false;
+        for (int v = 0; v < NUMVECTORS; v++) {
+            memcpy(search->state[depth + 1][v], search->state[depth][v], sizeof(search->state[depth][v]));
+            executeRType(word, search->state[depth + 1][v]);
+            changed = changed || search->state[depth + 1][v][wordDestReg(word)]
+                != search->state[depth][v][wordDestReg(word)];
+        }
+        if (!changed) {
+            continue;
+        }
+        search->sequence[depth] = word;
+        if (searchFrom(search, depth + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Takes first instructions in order until one at or past the best solution
+// so far. Keeping the lowest first instruction makes the answer the same
+// for any number of threads.
+static void *searchWorker(void *arg) {
+    Search *search = arg;
+    for (;;) {
+        pthread_mutex_lock(&searchLock);
+        int first = nextFirst++;
+        bool done = first >= bestFirst;
+        pthread_mutex_unlock(&searchLock);
+        if (done) {
+            break;
+        }
+        search->sequence[0] = candidates[first];
+        for (int v = 0; v < NUMVECTORS; v++) {
+            memcpy(search->state[1][v], vectors[v], sizeof(vectors[v]));
+            executeRType(candidates[first], search->state[1][v]);
+        }
+        if (searchFrom(search, 1)) {
+            pthread_mutex_lock(&searchLock);
+            if (first < bestFirst) {
+                bestFirst = first;
+                memcpy(bestSequence, search->sequence, sizeof(bestSequence));
+            }
+            pthread_mutex_unlock(&searchLock);
+        }
+    }
+    free(search);
+    return NULL;
+}
+
+// Prints words as assembly. With names, registers other than 0 print as
+// their names[] letter.
+static void printWords(FILE *outFilePtr, int *words, int length, char *separator, char *names) {
+    for (int i = 0; i < length; i++) {
+        int regs[3] = {wordRegA(words[i]), wordRegB(words[i]), wordDestReg(words[i])};
+        fprintf(outFilePtr, "%s", wordOpcode(words[i]) == OP_ADD ? "add" : "nor");
+        for (int j = 0; j < 3; j++) {
+            if (names != NULL && regs[j] != 0) {
+                fprintf(outFilePtr, " %c", names[regs[j]]);
+            } else {
+                fprintf(outFilePtr, " %d", regs[j]);
+            }
+        }
+        fprintf(outFilePtr, "%s", i + 1 < length ? separator : "");
+    }
+}
+
+static void printSequence(FILE *outFilePtr, int *words, int length, char *separator) {
+    printWords(outFilePtr, words, length, separator, NULL);
+    fprintf(outFilePtr, "\n");
+}
+
+// Appends "pattern => replacement" with registers renamed a, b, c... in
+// order of appearance, unless the rule file already has it.
+static void addRule(char *rulesFileStr, int *sequence, int length) {
+    char names[NUMREGS] = {0};
+    char next = 'a';
+    for (int i = 0; i < snippetLength; i++) {
+        int regs[3] = {wordRegA(snippet[i]), wordRegB(snippet[i]), wordDestReg(snippet[i])};
+        for (int j = 0; j < 3; j++) {
+            if (regs[j] != 0 && names[regs[j]] == 0) {
+                names[regs[j]] = next++;
+            }
+        }
+    }
+
+    char rule[MAXLINELENGTH], line[MAXLINELENGTH];
+    FILE *ruleFilePtr = fmemopen(rule, sizeof(rule), "w");
+    if (ruleFilePtr == NULL) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+    printWords(ruleFilePtr, snippet, snippetLength, "; ", names);
+    fprintf(ruleFilePtr, " => ");
+    printWords(ruleFilePtr, sequence, length, "; ", names);
+    fprintf(ruleFilePtr, "\n");
+    fclose(ruleFilePtr);
+
+    FILE *rulesFilePtr = fopen(rulesFileStr, "r");
+    if (rulesFilePtr != NULL) {
+        while (fgets(line, MAXLINELENGTH, rulesFilePtr) != NULL) {
+            if (strcmp(line, rule) == 0) {
+                fclose(rulesFilePtr);
+                printf("rule already in %s\n", rulesFileStr);
+                return;
+            }
+        }
+        fclose(rulesFilePtr);
+    }
+    rulesFilePtr = fopen(rulesFileStr, "a");
+    if (rulesFilePtr == NULL) {
+        printf("error in opening %s\n", rulesFileStr);
+        exit(1);
+    }
+    fputs(rule, rulesFilePtr);
+    fclose(rulesFilePtr);
+    printf("added rule to %s: %s", rulesFileStr, rule);
+}
@@ -0,0 +1,33010 @@
+        lw      0       1       big
+        beq     0       0       end
+back    lw      0       2       two
+        halt
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+        noop
+end     sw      0       1       spare
+        lw      0       3       spare
+        beq     0       0       back
+big     .fill   77
+two     .fill   2
+spare   .fill   0
@@ -0,0 +1,8 @@
+        movi    1       5
+        movi    2       1
+        movi    3       1
+loop    muli    2       3       2
+        sub     1       3       1
+        beq     1       0       done
+        beq     0       0       loop
+done    halt
@@ -0,0 +1,13 @@
+        lw      0       1       neg
+        lw      1       2       40000
+        sw      1       2       40001
+        lw      1       3       40001
+        lw      1       1       40000
+        beq     0       0       far
+        halt
+far     add     2       3       5
+        beq     5       2       -40000
+        halt
+neg     .fill   -39972
+        .fill   77
+        .fill   0
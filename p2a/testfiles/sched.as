@@ -0,0 +1,11 @@
+        lw      0       1       one
+        add     1       1       2
+        lw      0       3       two
+        add     3       3       4
+        add     0       0       5
+loop    lw      0       6       one
+        beq     6       0       done
+        add     2       4       5
+done    halt
+one     .fill   1
+two     .fill   2
@@ -0,0 +1,186 @@
+/**
+ * Project 2
+ * LC-2K Archiver
+ *
+ * Bundles object files into a library the linker can pull members out of:
+ *
+ *   !<lc2k-lib>
+ *   <number of members> <number of symbols>
+ *   <member name> <offset> <size>      one line per member
+ *   <label> <member index>             one line per exported label
+ *   <the members' object files, back to back>
+ *
+ * Member offsets count from the first byte after the symbol index, so the
+ * linker only has to read the index and the members it selects.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAXLINELENGTH 1000
+#define LIBRARYMAGIC "!<lc2k-lib>"
+
+typedef struct Member Member;
+typedef struct Export Export;
+
+struct Member {
+	const char *name; // without any directories
+	char *contents;
+	long size;
+};
+
+struct Export {
+	char label[7];
+	unsigned int member;
+};
+
+static void *allocate(size_t count, size_t size) {
+    void *memory = calloc(count ? count : 1, size);
+    if (memory == NULL) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// Copies the next line of contents into line. Returns NULL at the end.
+static char *nextLine(char *line, char **contents) {
+    if (**contents == '\0') {
+        return NULL;
+    }
+    size_t length = strcspn(*contents, "\n");
+    if (length >= MAXLINELENGTH) {
+        length = MAXLINELENGTH - 1;
+    }
+    memcpy(line, *contents, length);
+    line[length] = '\0';
+    *contents += strcspn(*contents, "\n");
+    if (**contents == '\n') {
+        (*contents)++;
+    }
+    return line;
+}
+
+int main(int argc, char *argv[]) {
+	char line[MAXLINELENGTH];
+	unsigned int i, j;
+
+    if (argc <= 2) {
+        printf("error: usage: %s <library-file> <object-file> ...\n", argv[0]);
+        exit(1);
+    }
+
+    unsigned int numMembers = argc - 2;
+    Member *members = allocate(numMembers, sizeof(Member));
+    unsigned int numExports = 0, maxExports = 0;
+    Export *exports = NULL;
+
+    for (i = 0; i < numMembers; i++) {
+        const char *inFileStr = argv[i + 2];
+        const char *slash = strrchr(inFileStr, '/');
+        members[i].name = slash ? slash + 1 : inFileStr;
+        if (strpbrk(members[i].name, " \t") || members[i].name[0] == '\0') {
+            printf("error: member name '%s' can't contain spaces\n", members[i].name);
+            exit(1);
+        }
+        for (j = 0; j < i; j++) {
+            if (!strcmp(members[j].name, members[i].name)) {
+                printf("error: two members named %s\n", members[i].name);
+                exit(1);
+            }
+        }
+
+        FILE *inFilePtr = fopen(inFileStr, "r");
+        if (inFilePtr == NULL) {
+            printf("error in opening %s\n", inFileStr);
+            exit(1);
+        }
+        fseek(inFilePtr, 0, SEEK_END);
+        members[i].size = ftell(inFilePtr);
+        rewind(inFilePtr);
+        members[i].contents = allocate(members[i].size + 1, 1);
+        if (fread(members[i].contents, 1, members[i].size, inFilePtr) != (size_t)members[i].size) {
+            printf("error in reading %s\n", inFileStr);
+            exit(1);
+        }
+        fclose(inFilePtr);
+        if (members[i].size == 0 || members[i].contents[members[i].size - 1] != '\n') {
+            printf("error: %s does not end with a newline\n", inFileStr);
+            exit(1);
+        }
+
+        // Skip the sections and collect the labels defined in the symbol table
+        char *contents = members[i].contents;
+        unsigned int sizeText, sizeData, sizeSymbol, sizeReloc;
+        if (!nextLine(line, &contents)
+                || sscanf(line, "%u %u %u %u", &sizeText, &sizeData, &sizeSymbol, &sizeReloc) != 4) {
+            printf("error: bad header line in %s\n", inFileStr);
+            exit(1);
+        }
+        for (j = 0; j < sizeText + sizeData; j++) {
+            if (!nextLine(line, &contents)) {
+                printf("error: %s ends before its header says it should\n", inFileStr);
+                exit(1);
+            }
+        }
+        for (j = 0; j < sizeSymbol; j++) {
+            char label[7], location;
+            unsigned int offset;
+            if (!nextLine(line, &contents)
+                    || sscanf(line, "%6s %c %u", label, &location, &offset) != 3) {
+                printf("error: bad symbol table line in %s\n", inFileStr);
+                exit(1);
+            }
+            if (location == 'U') {
+                continue;
+            }
+            for (unsigned int k = 0; k < numExports; k++) {
+                if (!strcmp(exports[k].label, label)) {
+                    printf("error: duplicate label '%s' in %s and %s\n", label,
+                           members[exports[k].member].name, members[i].name);
+                    exit(1);
+                }
+            }
+            if (numExports == maxExports) {
+                maxExports = maxExports ? 2 * maxExports : 64;
+                exports = realloc(exports, maxExports * sizeof(Export));
+                if (exports == NULL) {
+                    printf("error: out of memory\n");
+                    exit(1);
+                }
+            }
+            strcpy(exports[numExports].label, label);
+            exports[numExports].member = i;
+            numExports++;
+        }
+    }
+
+    FILE *outFilePtr = fopen(argv[1], "w");
+    if (outFilePtr == NULL) {
+        printf("error in opening %s\n", argv[1]);
+        exit(1);
+    }
+    fprintf(outFilePtr, "%s\n%u %u\n", LIBRARYMAGIC, numMembers, numExports);
+    long offset = 0;
+    for (i = 0; i < numMembers; i++) {
+        fprintf(outFilePtr, "%s %ld %ld\n", members[i].name, offset, members[i].size);
+        offset += members[i].size;
+    }
+    for (i = 0; i < numExports; i++) {
+        fprintf(outFilePtr, "%s %u\n", exports[i].label, exports[i].member);
+    }
+    for (i = 0; i < numMembers; i++) {
+        fwrite(members[i].contents, 1, members[i].size, outFilePtr);
+        free(members[i].contents);
+    }
+    if (fclose(outFilePtr)) {
+        printf("error in writing %s\n", argv[1]);
+        exit(1);
+    }
+    printf("archived %u members exporting %u labels into %s\n", numMembers, numExports, argv[1]);
+
+    free(exports);
+    free(members);
+    return 0;
+}
@@ -0,0 +1,1334 @@
+/**
+ * Project 2
+ * LC-2K linking as a library
+ *
+ * Parsing, layout, symbol resolution and relocation. Nothing here prints,
+ * exits or keeps state between calls; failures are returned to the caller.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lc2k_link_internal.h"
+
+// calloc that never returns NULL for 0 elements, only when out of memory
+static void *tryAllocate(size_t count, size_t size) {
+    return calloc(count ? count : 1, size);
+}
+
+// Appends a line to diag. Returns -1 for the caller to pass on.
+static int addDiagnostic(lc2k_diag *diag, const char *format, ...) {
+    size_t length = strlen(diag->message);
+    va_list args;
+    va_start(args, format);
+    int needed = vsnprintf(diag->message + length, sizeof(diag->message) - length, format, args);
+    va_end(args);
+    if (needed < 0 || (size_t)needed >= sizeof(diag->message) - length) {
+        diag->message[length] = '\0'; // keep whole lines only
+        diag->truncated = true;
+    }
+    diag->numErrors++;
+    return -1;
+}
+
+// Fibonacci hashing: the top bits of the key times 2^64 / phi
+static unsigned int hashLabel(LabelKey label) {
+    return (unsigned int)((label * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+// Returns 0, or -1 if out of memory.
+int initSymbolHashTable(SymbolHashTable *table, unsigned int expected) {
+    table->capacity = 16;
+    while (table->capacity < 2 * expected) {
+        table->capacity *= 2;
+    }
+    table->count = 0;
+    table->slots = tryAllocate(table->capacity, sizeof(GlobalSymbol));
+    return table->slots != NULL ? 0 : -1;
+}
+
+// Returns the slot holding label, or the empty slot where it would go.
+static GlobalSymbol *findSlot(SymbolHashTable *table, LabelKey label) {
+    unsigned int mask = table->capacity - 1;
+    unsigned int i = hashLabel(label) & mask;
+    while (table->slots[i].label != 0 && table->slots[i].label != label) {
+        i = (i + 1) & mask;
+    }
+    return &table->slots[i];
+}
+
+// Adds a global. Returns 0 if the label is already defined.
+int insertGlobal(SymbolHashTable *table, LabelKey label, int address) {
+    GlobalSymbol *slot = findSlot(table, label);
+    if (slot->label != 0) {
+        return 0;
+    }
+    slot->label = label;
+    slot->address = address;
+    table->count++;
+    return 1;
+}
+
+//
+// Helper: find symbol in the global table
+// Returns the absolute address if found, or -1 if not found.
+//
+int findSymbolAddress(SymbolHashTable *table, LabelKey label) {
+    GlobalSymbol *slot = findSlot(table, label);
+    return slot->label != 0 ? slot->address : -1;
+}
+
+struct ParallelWork {
+	ParallelTask task;
+	void *context;
+	unsigned int count;
+	unsigned int next; // next index to hand out, guarded by lock
+	pthread_mutex_t lock;
+};
+
+static void *parallelWorker(void *arg) {
+    struct ParallelWork *work = arg;
+    for (;;) {
+        pthread_mutex_lock(&work->lock);
+        unsigned int index = work->next++;
+        pthread_mutex_unlock(&work->lock);
+        if (index >= work->count) {
+            return NULL;
+        }
+        work->task(work->context, index);
+    }
+}
+
+// Runs task(context, i) for every i < count on a pool of threads, one per
+// core if threads is 0. Indices are handed out in order; tasks must not
+// depend on each other. Falls back to the calling thread if no thread can
+// be started.
+void parallelFor(unsigned int count, unsigned int threads, ParallelTask task, void *context) {
+    unsigned int numThreads = threads;
+    if (numThreads == 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = cores > 1 ? (unsigned int)cores : 1;
+    }
+    if (numThreads > count) {
+        numThreads = count;
+    }
+    struct ParallelWork work = {task, context, count, 0, PTHREAD_MUTEX_INITIALIZER};
+    pthread_t *pool = numThreads > 1 ? tryAllocate(numThreads, sizeof(pthread_t)) : NULL;
+    if (pool == NULL) {
+        parallelWorker(&work);
+        return;
+    }
+    unsigned int started = 0;
+    for (; started < numThreads; started++) {
+        if (pthread_create(&pool[started], NULL, parallelWorker, &work)) {
+            break; // the threads already running pick up the rest
+        }
+    }
+    if (started == 0) {
+        parallelWorker(&work);
+    }
+    for (unsigned int t = 0; t < started; t++) {
+        pthread_join(pool[t], NULL);
+    }
+    free(pool);
+}
+
+// Records why file could not be read. Returns -1 for the caller to pass on.
+int fileError(FileData *file, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    vsnprintf(file->error, sizeof(file->error), format, args);
+    va_end(args);
+    return -1;
+}
+
+static int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+static void skipSpaces(struct ObjectReader *reader) {
+    while (reader->pos < reader->end && (*reader->pos == ' ' || *reader->pos == '\t')) {
+        reader->pos++;
+    }
+}
+
+// Moves past the end of the line, which may only have trailing whitespace.
+int endLine(struct ObjectReader *reader) {
+    skipSpaces(reader);
+    if (reader->pos < reader->end && *reader->pos == '\r') {
+        reader->pos++;
+    }
+    if (reader->pos == reader->end) {
+        return 0;
+    }
+    if (*reader->pos != '\n') {
+        return -1;
+    }
+    reader->pos++;
+    reader->lineNumber++;
+    return 0;
+}
+
+int parseUnsigned(struct ObjectReader *reader, unsigned int *value) {
+    skipSpaces(reader);
+    const char *start = reader->pos;
+    unsigned long long result = 0;
+    while (reader->pos < reader->end && *reader->pos >= '0' && *reader->pos <= '9') {
+        result = result * 10 + (*reader->pos++ - '0');
+        if (result > 0xFFFFFFFFu) {
+            return -1;
+        }
+    }
+    *value = (unsigned int)result;
+    return reader->pos == start ? -1 : 0;
+}
+
+// Parses a section word: the assembler's fixed-width 0xXXXXXXXX, or any
+// other hex or decimal number, possibly negative.
+int parseWord(struct ObjectReader *reader, int *value) {
+    const char *p = reader->pos;
+    if (reader->end - p >= 11 && p[0] == '0' && p[1] == 'x' && p[10] == '\n') {
+        unsigned int word = 0;
+        int i;
+        for (i = 2; i < 10; i++) {
+            int digit = hexDigitValue(p[i]);
+            if (digit < 0) {
+                break;
+            }
+            word = word << 4 | digit;
+        }
+        if (i == 10) {
+            *value = (int)word;
+            reader->pos += 11;
+            reader->lineNumber++;
+            return 0;
+        }
+    }
+
+    skipSpaces(reader);
+    bool negative = false;
+    if (reader->pos < reader->end && (*reader->pos == '-' || *reader->pos == '+')) {
+        negative = *reader->pos++ == '-';
+    }
+    unsigned long long result = 0;
+    const char *start;
+    if (reader->end - reader->pos > 2 && reader->pos[0] == '0'
+            && (reader->pos[1] == 'x' || reader->pos[1] == 'X')) {
+        reader->pos += 2;
+        start = reader->pos;
+        int digit;
+        while (reader->pos < reader->end && (digit = hexDigitValue(*reader->pos)) >= 0) {
+            result = result << 4 | digit;
+            reader->pos++;
+            if (result > 0xFFFFFFFFu) {
+                return -1;
+            }
+        }
+    } else {
+        start = reader->pos;
+        while (reader->pos < reader->end && *reader->pos >= '0' && *reader->pos <= '9') {
+            result = result * 10 + (*reader->pos++ - '0');
+            if (result > 0xFFFFFFFFu) {
+                return -1;
+            }
+        }
+    }
+    if (reader->pos == start) {
+        return -1;
+    }
+    *value = (int)(negative ? 0u - (unsigned int)result : (unsigned int)result);
+    return endLine(reader);
+}
+
+// Copies the next whitespace-delimited token, at most maxLength characters.
+int parseToken(struct ObjectReader *reader, char *token, unsigned int maxLength) {
+    skipSpaces(reader);
+    unsigned int length = 0;
+    while (reader->pos < reader->end && *reader->pos != ' ' && *reader->pos != '\t'
+            && *reader->pos != '\n' && *reader->pos != '\r') {
+        if (length == maxLength) {
+            return -1;
+        }
+        token[length++] = *reader->pos++;
+    }
+    token[length] = '\0';
+    return length == 0 ? -1 : 0;
+}
+
+// Parses a label into its key.
+int parseLabel(struct ObjectReader *reader, LabelKey *label) {
+    char text[MAXLABELLENGTH + 1];
+    if (parseToken(reader, text, MAXLABELLENGTH)) {
+        return -1;
+    }
+    *label = packLabel(text);
+    return 0;
+}
+
+int readerError(struct ObjectReader *reader, FileData *file, const char *expected) {
+    if (reader->pos == reader->end) {
+        return fileError(file, "error: %s ends before its header says it should\n",
+            reader->inFileStr);
+    }
+    return fileError(file, "error: %s:%u: expected %s\n", reader->inFileStr,
+        reader->lineNumber, expected);
+}
+
+// Parses an object file in memory into file, allocating its sections and
+// tables from the sizes on its header line. Without sections, file->text
+// and file->data stay NULL and only where the words are is kept: when the
+// first and last are the assembler's fixed-width lines, the words are
+// stepped over without being looked at, otherwise they are checked but not
+// kept. Returns 0, or -1 with file->error set.
+int parseObjectFile(struct ObjectReader *reader, FileData *file, unsigned int fileIndex,
+        bool sections) {
+    const char *begin = reader->pos;
+    unsigned int j;
+    int word;
+
+    // parse first line of file
+    if (parseUnsigned(reader, &file->textSize) || parseUnsigned(reader, &file->dataSize)
+            || parseUnsigned(reader, &file->symbolTableSize)
+            || parseUnsigned(reader, &file->relocationTableSize) || endLine(reader)) {
+        return fileError(file, "error: bad header line in %s\n", reader->inFileStr);
+    }
+    if (sections) {
+        file->text = tryAllocate(file->textSize, sizeof(int));
+        file->data = tryAllocate(file->dataSize, sizeof(int));
+    }
+    file->symbolTable = tryAllocate(file->symbolTableSize, sizeof(SymbolTableEntry));
+    file->relocTable = tryAllocate(file->relocationTableSize, sizeof(RelocationTableEntry));
+    if ((sections && (!file->text || !file->data)) || !file->symbolTable || !file->relocTable) {
+        return fileError(file, "error: out of memory\n");
+    }
+
+    file->sectionsOffset = reader->pos - begin;
+    unsigned int numWords = file->textSize + file->dataSize;
+    size_t skip = 11 * (size_t)numWords;
+    const char *p = reader->pos;
+    bool skipped = false;
+    if (!sections && numWords > 0 && (size_t)(reader->end - p) >= skip
+            && p[0] == '0' && p[1] == 'x' && p[10] == '\n'
+            && p[skip - 11] == '0' && p[skip - 10] == 'x' && p[skip - 1] == '\n') {
+        reader->pos += skip;
+        reader->lineNumber += numWords;
+        skipped = true;
+    }
+
+    // read in text section
+    for (j = 0; !skipped && j < file->textSize; ++j) {
+        if (parseWord(reader, sections ? &file->text[j] : &word)) {
+            return readerError(reader, file, "a text word");
+        }
+    }
+
+    // read in data section
+    for (j = 0; !skipped && j < file->dataSize; ++j) {
+        if (parseWord(reader, sections ? &file->data[j] : &word)) {
+            return readerError(reader, file, "a data word");
+        }
+    }
+    file->sectionsEnd = reader->pos - begin;
+
+    // read in the symbol table
+    for (j = 0; j < file->symbolTableSize; ++j) {
+        SymbolTableEntry *sym = &file->symbolTable[j];
+        char location[2];
+        if (parseLabel(reader, &sym->label)
+                || parseToken(reader, location, 1)
+                || parseUnsigned(reader, &sym->offset) || endLine(reader)) {
+            return readerError(reader, file, "a symbol table line (label, T/D/U, offset)");
+        }
+        sym->location = location[0];
+    }
+
+    // read in relocation table
+    for (j = 0; j < file->relocationTableSize; ++j) {
+        RelocationTableEntry *rel = &file->relocTable[j];
+        if (parseUnsigned(reader, &rel->offset)
+                || parseToken(reader, rel->inst, sizeof(rel->inst) - 1)
+                || parseLabel(reader, &rel->label) || endLine(reader)) {
+            return readerError(reader, file, "a relocation table line (offset, opcode, label)");
+        }
+        rel->file = fileIndex;
+        if (rel->offset >= (strcmp(rel->inst, ".fill") ? file->textSize : file->dataSize)) {
+            return fileError(file, "error: relocation offset %u out of range in %s\n",
+                rel->offset, reader->inFileStr);
+        }
+    }
+    return 0;
+}
+
+void freeFileData(FileData *file) {
+    free(file->text);
+    free(file->data);
+    free(file->symbolTable);
+    free(file->relocTable);
+    file->text = file->data = NULL;
+    file->symbolTable = NULL;
+    file->relocTable = NULL;
+}
+
+// Resolves the relocation entries of one file. Labels not in the global
+// table are local: the assembler left the label's address in this file in
+// the word, text first and then data.
+void resolveRelocationsTask(void *context, unsigned int i) {
+    struct RelocationContext *relocation = context;
+    FileData *file = &relocation->files[i];
+    CombinedFiles *combined = relocation->combined;
+    RelocationRecord *record = &relocation->records[relocation->firstRecord[i]];
+    for (unsigned int j = 0; j < file->relocationTableSize; j++, record++) {
+        RelocationTableEntry *rel = &file->relocTable[j];
+        bool isFill = !strcmp(rel->inst, ".fill");
+        bool isBeq = !strcmp(rel->inst, "beq");
+        bool isPool = !strcmp(rel->inst, ".pool");
+        record->kind = isFill ? RELOC_FILL : isBeq ? RELOC_BEQ
+            : isPool ? RELOC_POOL : RELOC_ABSOLUTE16;
+        record->index = isFill ? file->dataStartingLine + rel->offset
+            : file->textStartingLine + rel->offset;
+        if (!isFill && !isBeq && !isPool && strcmp(rel->inst, "lw") && strcmp(rel->inst, "sw")) {
+            record->kind = RELOC_NONE; // else handle more instructions if needed
+        }
+
+        // First find the symbol's final absolute address
+        record->value = findSymbolAddress(relocation->globals, rel->label);
+        if (record->value >= 0 && rel->veneer) {
+            record->value = rel->stub;
+        } else if (record->value < 0) {
+            if (isBeq) {
+                // PC-relative within the file, still right after merging
+                record->kind = RELOC_NONE;
+                continue;
+            }
+            // the sections may have been read straight into combined
+            int word = isFill ? (file->data ? file->data[rel->offset]
+                    : combined->data[file->dataStartingLine + rel->offset])
+                : (file->text ? file->text[rel->offset]
+                    : combined->text[file->textStartingLine + rel->offset]);
+            unsigned int localOffset = isFill || isPool ? (unsigned int)word
+                : (unsigned int)word & 0xFFFF;
+            if (localOffset < file->textSize) {
+                record->value = file->textStartingLine + localOffset;
+            } else {
+                record->value = combined->textSize + file->dataStartingLine
+                    + (localOffset - file->textSize);
+            }
+        }
+    }
+}
+
+void applyRelocation(CombinedFiles *combined, const RelocationRecord *record) {
+    switch (record->kind) {
+    case RELOC_FILL:
+        // For a .fill of a label, we store the absolute address.
+        combined->data[record->index] = record->value;
+        break;
+    case RELOC_BEQ:
+        // beq offset = symbolAddr - (PC+1)
+        combined->text[record->index] = (combined->text[record->index] & 0xFFFF0000)
+            | ((record->value - ((int)record->index + 1)) & 0xFFFF);
+        break;
+    case RELOC_ABSOLUTE16:
+        // place absolute address in bottom 16 bits
+        combined->text[record->index] = (combined->text[record->index] & 0xFFFF0000)
+            | (record->value & 0xFFFF);
+        break;
+    case RELOC_POOL:
+        combined->text[record->index] = record->value;
+        break;
+    }
+}
+
+void applyRelocationsTask(void *context, unsigned int i) {
+    struct RelocationContext *relocation = context;
+    RelocationRecord *record = &relocation->records[relocation->firstRecord[i]];
+    RelocationRecord *end = &relocation->records[relocation->firstRecord[i + 1]];
+    for (; record < end; record++) {
+        applyRelocation(relocation->combined, record);
+    }
+}
+
+// Returns -1 and reports it if record's value doesn't fit its word: a beq
+// that can't reach its label, or an lw or sw of an address its
+// sign-extended 16-bit offset can't hold.
+static int checkRelocation(const FileData *file, const RelocationTableEntry *rel,
+        const RelocationRecord *record, lc2k_diag *diag) {
+    char label[MAXLABELLENGTH + 1];
+    if (record->kind == RELOC_BEQ) {
+        int offset = record->value - ((int)record->index + 1);
+        if (offset < -32768 || offset > 32767) {
+            return addDiagnostic(diag, "error: beq to '%s' in %s is out of range (offset %d)\n",
+                unpackLabel(rel->label, label), file->name, offset);
+        }
+    } else if (record->kind == RELOC_ABSOLUTE16
+            && (record->value < -32768 || record->value > 32767)) {
+        return addDiagnostic(diag, "error: %s of '%s' in %s is out of range (address %d)\n",
+            rel->inst, unpackLabel(rel->label, label), file->name, record->value);
+    }
+    return 0;
+}
+
+// Checks every resolved relocation of the link. Returns 0, or -1 with the
+// ones out of range in *diag.
+static int checkRelocations(struct Link *link, lc2k_diag *diag) {
+    int status = 0;
+    for (unsigned int i = 0; i < link->numFiles; i++) {
+        FileData *file = &link->files[i];
+        RelocationRecord *record = &link->relocation.records[link->relocation.firstRecord[i]];
+        for (unsigned int j = 0; j < file->relocationTableSize; j++, record++) {
+            status |= checkRelocation(file, &file->relocTable[j], record, diag);
+        }
+    }
+    return status;
+}
+
+// The two words of a veneer's stub: lw 0 6 <pool word>, jalr 6 7.
+void encodeVeneer(const Veneer *veneer, int stub[2]) {
+    stub[0] = encodeIType(OP_LW, 0, SCRATCHREG, (int)veneer->poolWord);
+    stub[1] = encodeRType(OP_JALR, SCRATCHREG, RELAXLINKREG, 0);
+}
+
+// Drops the objects nothing refers to (--gc). The first object and the
+// definers of the keep labels are live, and so is every object that
+// defines a label a live object refers to. Sections inside an object refer
+// to each other through local labels, so whole objects are kept or dropped.
+// link->files is compacted in place. Returns 0 or -1.
+static int collectGarbage(struct Link *link, const lc2k_options *options, lc2k_diag *diag) {
+    FileData *files = link->files;
+    unsigned int numFiles = link->numFiles;
+    unsigned int i, j, numDefinitions = 0;
+    for (i = 0; i < numFiles; i++) {
+        numDefinitions += files[i].symbolTableSize;
+    }
+    // label to defining file
+    SymbolHashTable definers;
+    bool *live = tryAllocate(numFiles, sizeof(bool));
+    unsigned int *worklist = tryAllocate(numFiles, sizeof(unsigned int));
+    int status = initSymbolHashTable(&definers, numDefinitions);
+    if (status || !live || !worklist) {
+        status = addDiagnostic(diag, "error: out of memory\n");
+    }
+    for (i = 0; status == 0 && i < numFiles; i++) {
+        for (j = 0; j < files[i].symbolTableSize; j++) {
+            SymbolTableEntry *sym = &files[i].symbolTable[j];
+            if (sym->location != 'U' && !insertGlobal(&definers, sym->label, i)) {
+                char label[MAXLABELLENGTH + 1];
+                status = addDiagnostic(diag, "error: duplicate label '%s' found in multiple files\n",
+                    unpackLabel(sym->label, label));
+                break;
+            }
+        }
+    }
+
+    unsigned int numWork = 0;
+    if (status == 0) {
+        live[0] = true;
+        worklist[numWork++] = 0;
+    }
+    for (i = 0; status == 0 && i < options->numKeepLabels; i++) {
+        LabelKey label = packLabel(options->keepLabels[i]);
+        int definer = label != 0 ? findSymbolAddress(&definers, label) : -1;
+        if (definer < 0) {
+            status = addDiagnostic(diag, "error: --keep label '%s' is not defined\n",
+                options->keepLabels[i]);
+        } else if (!live[definer]) {
+            live[definer] = true;
+            worklist[numWork++] = definer;
+        }
+    }
+    while (status == 0 && numWork > 0) {
+        FileData *file = &files[worklist[--numWork]];
+        for (j = 0; j < file->symbolTableSize; j++) {
+            if (file->symbolTable[j].location != 'U') {
+                continue;
+            }
+            int definer = findSymbolAddress(&definers, file->symbolTable[j].label);
+            if (definer >= 0 && !live[definer]) {
+                live[definer] = true;
+                worklist[numWork++] = definer;
+            }
+        }
+    }
+
+    if (status == 0) {
+        unsigned int numKept = 0;
+        link->wordsRemoved = 0;
+        for (i = 0; i < numFiles; i++) {
+            if (live[i]) {
+                files[numKept++] = files[i];
+                continue;
+            }
+            link->wordsRemoved += files[i].textSize + files[i].dataSize;
+            freeFileData(&files[i]);
+        }
+        link->numFilesRemoved = numFiles - numKept;
+        link->numFiles = numKept;
+        link->collected = true;
+    }
+    free(worklist);
+    free(live);
+    free(definers.slots);
+    return status;
+}
+
+// Identical data folding (--fold-data). A data run starts at a word that
+// some label refers to and ends before the next such word or at the end of
+// its object; as with section folding in other linkers, indexing from a
+// label is taken to stay inside its run. A run that is only ever read by
+// lw, has no global label and holds no relocated word may share the storage
+// of an identical earlier run. Anything written, exported or address-taken
+// keeps its own copy. Folded runs are dropped from the data section and
+// every address into them moves to the copy that stays.
+enum {
+	DATA_ENTRY = 1,    // a label refers to this word
+	DATA_PINNED = 2,   // ... and needs it to stay where it is
+	DATA_RELOCATED = 4 // a .fill the relocations patch
+};
+
+static unsigned int remapAddress(int address, unsigned int textSize, unsigned int dataSize,
+        const unsigned int *newIndex) {
+    if (address < (int)textSize || address > (int)(textSize + dataSize)) {
+        return address;
+    }
+    return textSize + newIndex[address - textSize];
+}
+
+// The file at position k of order, or of the input order without one
+static unsigned int fileAt(const unsigned int *order, unsigned int k) {
+    return order ? order[k] : k;
+}
+
+static int foldData(struct Link *link, lc2k_diag *diag) {
+    CombinedFiles *combined = &link->combined;
+    struct RelocationContext *relocation = &link->relocation;
+    unsigned int textSize = combined->textSize, dataSize = combined->dataSize;
+    unsigned int i, j, w;
+
+    unsigned char *flags = tryAllocate(dataSize, sizeof(unsigned char));
+    int *foldedInto = tryAllocate(dataSize, sizeof(int));
+    unsigned int *runEnd = tryAllocate(dataSize, sizeof(unsigned int));
+    unsigned int *newIndex = tryAllocate(dataSize + 1, sizeof(unsigned int));
+    SymbolHashTable runs;
+    runs.slots = NULL;
+    int status = 0;
+    if (!flags || !foldedInto || !runEnd || !newIndex || initSymbolHashTable(&runs, dataSize)) {
+        status = addDiagnostic(diag, "error: out of memory\n");
+    }
+
+    for (i = 0; status == 0 && i < link->numFiles; i++) {
+        FileData *file = &link->files[i];
+        for (j = 0; j < file->symbolTableSize; j++) {
+            SymbolTableEntry *sym = &file->symbolTable[j];
+            if (sym->location == 'D' && sym->offset < file->dataSize) {
+                flags[file->dataStartingLine + sym->offset] |= DATA_ENTRY | DATA_PINNED;
+            }
+        }
+        RelocationRecord *record = &relocation->records[relocation->firstRecord[i]];
+        for (j = 0; j < file->relocationTableSize; j++, record++) {
+            if (record->kind == RELOC_FILL) {
+                flags[record->index] |= DATA_RELOCATED;
+            }
+            if (record->kind == RELOC_NONE || record->value < (int)textSize
+                    || record->value >= (int)(textSize + dataSize)) {
+                continue;
+            }
+            w = record->value - textSize;
+            flags[w] |= DATA_ENTRY;
+            if (record->kind != RELOC_ABSOLUTE16 || strcmp(file->relocTable[j].inst, "lw")) {
+                flags[w] |= DATA_PINNED;
+            }
+        }
+    }
+
+    // Look each foldable run up by a hash of its words; the first of a set
+    // of identical runs is the one kept
+    for (i = 0; status == 0 && i < link->numFiles; i++) {
+        FileData *file = &link->files[fileAt(link->dataOrder, i)];
+        unsigned int end = file->dataStartingLine + file->dataSize;
+        for (w = file->dataStartingLine; w < end; w = runEnd[w]) {
+            runEnd[w] = w + 1;
+            while (runEnd[w] < end && !(flags[runEnd[w]] & DATA_ENTRY)) {
+                runEnd[w]++;
+            }
+            for (j = w; j < runEnd[w]; j++) {
+                foldedInto[j] = -1;
+            }
+            if ((flags[w] & (DATA_ENTRY | DATA_PINNED)) != DATA_ENTRY) {
+                continue;
+            }
+            unsigned int length = runEnd[w] - w;
+            uint64_t hash = 14695981039346656037ull ^ length;
+            for (j = w; j < runEnd[w] && !(flags[j] & DATA_RELOCATED); j++) {
+                hash = (hash ^ (unsigned int)combined->data[j]) * 1099511628211ull;
+            }
+            if (j < runEnd[w]) {
+                continue;
+            }
+            hash |= 1; // 0 marks an empty slot
+            int kept = findSymbolAddress(&runs, hash);
+            if (kept < 0) {
+                insertGlobal(&runs, hash, w);
+            } else if (runEnd[kept] - kept == length
+                    && !memcmp(&combined->data[kept], &combined->data[w], length * sizeof(int))) {
+                for (j = 0; j < length; j++) {
+                    foldedInto[w + j] = kept + j;
+                }
+                file->dataFolded += length;
+                link->runsFolded++;
+                link->wordsFolded += length;
+            }
+        }
+    }
+
+    // Compact the data section in place and move everything that points into it
+    if (status == 0 && link->runsFolded > 0) {
+        unsigned int next = 0;
+        for (i = 0; i < link->numFiles; i++) {
+            FileData *file = &link->files[fileAt(link->dataOrder, i)];
+            unsigned int start = file->dataStartingLine;
+            file->dataStartingLine = next;
+            for (w = start; w < start + file->dataSize; w++) {
+                if (foldedInto[w] >= 0) {
+                    newIndex[w] = newIndex[foldedInto[w]];
+                } else {
+                    newIndex[w] = next;
+                    combined->data[next++] = combined->data[w];
+                }
+            }
+        }
+        newIndex[dataSize] = next; // Stack
+        for (j = 0; j < relocation->firstRecord[link->numFiles]; j++) {
+            RelocationRecord *record = &relocation->records[j];
+            if (record->kind == RELOC_FILL) {
+                record->index = newIndex[record->index];
+            }
+            if (record->kind != RELOC_NONE) {
+                record->value = remapAddress(record->value, textSize, dataSize, newIndex);
+            }
+        }
+        for (j = 0; j < link->globals.capacity; j++) {
+            GlobalSymbol *slot = &link->globals.slots[j];
+            if (slot->label != 0) {
+                slot->address = remapAddress(slot->address, textSize, dataSize, newIndex);
+            }
+        }
+        combined->dataSize = next;
+        combined->stack = textSize + next;
+    }
+    free(runs.slots);
+    free(newIndex);
+    free(runEnd);
+    free(foldedInto);
+    free(flags);
+    return status;
+}
+
+// Lays out link->files, in the input order or the one a profile chose, and
+// puts every label they define into link->globals, from the headers and
+// symbol tables alone.
+static int defineGlobals(struct Link *link, lc2k_diag *diag) {
+    unsigned int i, j;
+    FileData *files = link->files;
+    unsigned int numFiles = link->numFiles;
+    CombinedFiles *combined = &link->combined;
+    combined->textSize = combined->dataSize = 0;
+    free(link->globals.slots);
+    link->globals.slots = NULL;
+    link->layoutPasses++;
+
+	// -----------------------------------------------------
+	// 1) Merge the text and data sections in order:
+	//    - We'll record where each file's text & data now starts
+	//    - Then copy them into the combined text[] and data[] arrays
+	// -----------------------------------------------------
+	// 2) Merge text and data sections in the order read
+	//    Each file's veneers follow its text, and the veneer pool follows
+	//    the first file's.
+    unsigned int numVeneers = 0;
+    for (i = 0; i < numFiles; i++) {
+        numVeneers += files[i].numVeneers;
+    }
+    for (i = 0; i < numFiles; i++) {
+        FileData *file = &files[fileAt(link->textOrder, i)];
+        file->textStartingLine = combined->textSize;
+        combined->textSize += file->textSize + 2 * file->numVeneers;
+        if (i == 0) {
+            link->veneerPool = combined->textSize;
+            combined->textSize += numVeneers;
+        }
+    }
+    for (i = 0; i < numFiles; i++) {
+        FileData *file = &files[fileAt(link->dataOrder, i)];
+        file->dataStartingLine = combined->dataSize;
+        combined->dataSize += file->dataSize;
+    }
+
+    // 3) Build global symbol table (skip 'U')
+    //    Every global goes into a hash table keyed by label, already
+    //    resolved to its final address: text globals at their text line,
+    //    data globals after all of the text.
+    unsigned int numDefinitions = 0;
+    for (i = 0; i < numFiles; i++) {
+        numDefinitions += files[i].symbolTableSize;
+    }
+    if (initSymbolHashTable(&link->globals, numDefinitions + 1)) {
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    for (i = 0; i < numFiles; i++) {
+        for (j = 0; j < files[i].symbolTableSize; j++) {
+            SymbolTableEntry *sym = &files[i].symbolTable[j];
+            if (sym->location == 'U') {
+                // 'U' means undefined reference => not a definition
+                continue;
+            }
+            int address;
+            if (sym->location == 'T') {
+                address = files[i].textStartingLine + sym->offset;
+            }
+            else if (sym->location == 'D') {
+                address = combined->textSize + files[i].dataStartingLine + sym->offset;
+            }
+            else {
+                // If there's some other letter, assume we keep the offset as is
+                address = sym->offset;
+            }
+            if (!insertGlobal(&link->globals, sym->label, address)) {
+                char label[MAXLABELLENGTH + 1];
+                return addDiagnostic(diag, "error: duplicate label '%s' found in multiple files\n",
+                    unpackLabel(sym->label, label));
+            }
+        }
+    }
+    return 0;
+}
+
+// Sends every beq whose label is out of its reach through a veneer. Adding
+// veneers moves the files after them, which can take more branches out of
+// range, so the layout is redone until no more are needed; a beq keeps its
+// veneer once it has one, so this converges. Returns 0, or -1 with the
+// branches that still can't be made to reach in *diag.
+static int addVeneers(struct Link *link, lc2k_diag *diag) {
+    unsigned int i, j, k;
+    FileData *files = link->files;
+    bool grew = true;
+    while (grew) {
+        grew = false;
+        for (i = 0; i < link->numFiles; i++) {
+            for (j = 0; j < files[i].relocationTableSize; j++) {
+                RelocationTableEntry *rel = &files[i].relocTable[j];
+                if (rel->veneer || strcmp(rel->inst, "beq")) {
+                    continue;
+                }
+                // a label of the same file moves with the beq
+                int target = findSymbolAddress(&link->globals, rel->label);
+                int offset = target - (int)(files[i].textStartingLine + rel->offset + 1);
+                if (target >= 0 && (offset < -32768 || offset > 32767)) {
+                    rel->veneer = true;
+                    files[i].numVeneers++;
+                    link->numVeneers++;
+                    grew = true;
+                }
+            }
+        }
+        if (grew && defineGlobals(link, diag)) {
+            return -1;
+        }
+    }
+    if (link->numVeneers == 0) {
+        return 0;
+    }
+
+    link->veneers = tryAllocate(link->numVeneers, sizeof(Veneer));
+    if (link->veneers == NULL) {
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    Veneer *veneer = link->veneers;
+    for (i = 0; i < link->numFiles; i++) {
+        unsigned int stub = files[i].textStartingLine + files[i].textSize;
+        for (j = 0, k = 0; j < files[i].relocationTableSize; j++) {
+            RelocationTableEntry *rel = &files[i].relocTable[j];
+            if (!rel->veneer) {
+                continue;
+            }
+            rel->stub = stub + 2 * k++;
+            veneer->file = i;
+            veneer->relocation = j;
+            veneer->stub = rel->stub;
+            veneer->poolWord = link->veneerPool + (unsigned int)(veneer - link->veneers);
+            veneer->target = findSymbolAddress(&link->globals, rel->label);
+            char label[MAXLABELLENGTH + 1];
+            if (veneer->stub - (files[i].textStartingLine + rel->offset + 1) > 32767) {
+                addDiagnostic(diag, "error: beq to '%s' in %s can't reach its veneer\n",
+                    unpackLabel(rel->label, label), files[i].name);
+            }
+            if (veneer->poolWord > 32767) {
+                addDiagnostic(diag, "error: the veneer for '%s' in %s is out of reach of lw\n",
+                    unpackLabel(rel->label, label), files[i].name);
+            }
+            veneer++;
+        }
+    }
+    return diag->numErrors > 0 ? -1 : 0;
+}
+
+struct ProfileRank {
+	double density; // profile count per word
+	unsigned int file;
+};
+
+// Hottest first; files the profile never saw keep their order
+static int compareRanks(const void *a, const void *b) {
+    const struct ProfileRank *x = a, *y = b;
+    if (x->density != y->density) {
+        return x->density < y->density ? 1 : -1;
+    }
+    return x->file < y->file ? -1 : x->file > y->file;
+}
+
+// Counts the cache lines holding a word of text, or of data, that the
+// profile saw used. The profile's addresses are those of the layout in
+// from[] (each file's text or data address); the lines are those of the
+// files' current addresses.
+static unsigned int countHotLines(const struct Link *link, const lc2k_options *options,
+        const unsigned int *from, bool data, bool *hot) {
+    unsigned int numHot = 0;
+    for (unsigned int i = 0; i < link->numFiles; i++) {
+        const FileData *file = &link->files[i];
+        unsigned int size = data ? file->dataSize : file->textSize;
+        unsigned int to = data ? link->combined.textSize + file->dataStartingLine
+            : file->textStartingLine;
+        for (unsigned int w = 0; w < size && from[i] + w < options->profileSize; w++) {
+            unsigned int line = (to + w) / PROFILELINEWORDS;
+            if (options->profile[from[i] + w] != 0 && !hot[line]) {
+                hot[line] = true;
+                numHot++;
+            }
+        }
+    }
+    return numHot;
+}
+
+// Lays link->files out again by how hot the profile found them: text by
+// executions per word, data by accesses per word, so the hot words share
+// as few cache lines as they can. The first file stays first, since the
+// program starts at address 0. The profile's addresses are those of the
+// input order, which is how the files were laid out when this is called.
+static int orderByProfile(struct Link *link, const lc2k_options *options, lc2k_diag *diag) {
+    unsigned int i, j, w;
+    FileData *files = link->files;
+    unsigned int numFiles = link->numFiles;
+    unsigned int *from = tryAllocate(2 * numFiles, sizeof(unsigned int));
+    struct ProfileRank *ranks = tryAllocate(numFiles, sizeof(struct ProfileRank));
+    link->textOrder = tryAllocate(numFiles, sizeof(unsigned int));
+    link->dataOrder = tryAllocate(numFiles, sizeof(unsigned int));
+    size_t maxLines = (link->combined.textSize + link->combined.dataSize) / PROFILELINEWORDS + 1;
+    bool *hot = tryAllocate(maxLines, sizeof(bool));
+    if (!from || !ranks || !link->textOrder || !link->dataOrder || !hot) {
+        free(from);
+        free(ranks);
+        free(hot);
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    unsigned int *fromData = from + numFiles;
+    for (i = 0; i < numFiles; i++) {
+        from[i] = files[i].textStartingLine;
+        fromData[i] = link->combined.textSize + files[i].dataStartingLine;
+    }
+    link->hotTextLines[0] = countHotLines(link, options, from, false, hot);
+    memset(hot, 0, maxLines * sizeof(bool));
+    link->hotDataLines[0] = countHotLines(link, options, fromData, true, hot);
+
+    for (int data = 0; data < 2; data++) {
+        for (i = 0; i < numFiles; i++) {
+            unsigned int start = data ? fromData[i] : from[i];
+            unsigned int size = data ? files[i].dataSize
+                : files[i].textSize + 2 * files[i].numVeneers;
+            unsigned long long count = 0;
+            for (w = start; w < start + size && w < options->profileSize; w++) {
+                count += options->profile[w];
+            }
+            ranks[i].density = size ? (double)count / size : 0;
+            ranks[i].file = i;
+        }
+        if (data) {
+            qsort(ranks, numFiles, sizeof(struct ProfileRank), compareRanks);
+        } else if (numFiles > 1) {
+            qsort(ranks + 1, numFiles - 1, sizeof(struct ProfileRank), compareRanks);
+        }
+        for (i = 0; i < numFiles; i++) {
+            (data ? link->dataOrder : link->textOrder)[i] = ranks[i].file;
+        }
+    }
+
+    // Veneers depend on the layout; find them afresh for the new one
+    for (i = 0; i < numFiles; i++) {
+        files[i].numVeneers = 0;
+        for (j = 0; j < files[i].relocationTableSize; j++) {
+            files[i].relocTable[j].veneer = false;
+        }
+    }
+    free(link->veneers);
+    link->veneers = NULL;
+    link->numVeneers = 0;
+    link->layoutPasses = 0;
+    int status = defineGlobals(link, diag) || addVeneers(link, diag) ? -1 : 0;
+    if (status == 0) {
+        free(hot);
+        maxLines = (link->combined.textSize + link->combined.dataSize) / PROFILELINEWORDS + 1;
+        hot = tryAllocate(maxLines, sizeof(bool));
+        if (hot == NULL) {
+            status = addDiagnostic(diag, "error: out of memory\n");
+        }
+    }
+    if (status == 0) {
+        link->hotTextLines[1] = countHotLines(link, options, from, false, hot);
+        memset(hot, 0, maxLines * sizeof(bool));
+        link->hotDataLines[1] = countHotLines(link, options, fromData, true, hot);
+    }
+    free(from);
+    free(ranks);
+    free(hot);
+    return status;
+}
+
+// Drops unreachable files if asked, lays out link->files in order, or by a
+// profile, and resolves every global, from the headers and symbol tables
+// alone. Any number of undefined labels are reported together.
+int linkSymbols(struct Link *link, const lc2k_options *options, lc2k_diag *diag) {
+    unsigned int i, j;
+
+    // Folding moves data after the layout the profile's addresses refer to,
+    // so a profile of a folded link would land on the wrong files
+    if (options->profile != NULL && options->foldData) {
+        return addDiagnostic(diag, "error: a profile can't be used with foldData\n");
+    }
+
+    // drop the objects the program can't reach
+    if (options->gc && collectGarbage(link, options, diag)) {
+        return -1;
+    }
+    if (defineGlobals(link, diag) || addVeneers(link, diag)) {
+        return -1;
+    }
+    if (options->profile != NULL && orderByProfile(link, options, diag)) {
+        return -1;
+    }
+    FileData *files = link->files;
+    unsigned int numFiles = link->numFiles;
+    CombinedFiles *combined = &link->combined;
+
+    // Insert "Stack" label at first free location after text & data, so
+    // relocations against it resolve like any other global
+    combined->stack = combined->textSize + combined->dataSize;
+    if (!insertGlobal(&link->globals, packLabel("Stack"), combined->stack)) {
+        return addDiagnostic(diag, "error: 'Stack' label already defined\n");
+    }
+
+    // Every 'U' reference has to be defined somewhere; report them all
+    for (i = 0; i < numFiles; i++) {
+        for (j = 0; j < files[i].symbolTableSize; j++) {
+            SymbolTableEntry *sym = &files[i].symbolTable[j];
+            if (sym->location == 'U' && findSymbolAddress(&link->globals, sym->label) < 0) {
+                char label[MAXLABELLENGTH + 1];
+                addDiagnostic(diag, "error: undefined label '%s' in %s\n",
+                    unpackLabel(sym->label, label), files[i].name);
+            }
+        }
+    }
+    return diag->numErrors > 0 ? -1 : 0;
+}
+
+// Copies the sections of the laid out files into link->combined and
+// resolves their relocations into link->relocation.records. link->combined
+// may already be allocated, with the sections of the files without them
+// read in place.
+static int resolveRelocations(struct Link *link, const lc2k_options *options, lc2k_diag *diag) {
+    unsigned int i;
+    FileData *files = link->files;
+    unsigned int numFiles = link->numFiles;
+    CombinedFiles *combined = &link->combined;
+    if (combined->text == NULL) {
+        combined->text = tryAllocate(combined->textSize, sizeof(int));
+        combined->data = tryAllocate(combined->dataSize, sizeof(int));
+    }
+    if (combined->text == NULL || combined->data == NULL) {
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    for (i = 0; i < numFiles; i++) {
+        if (files[i].text == NULL) {
+            continue;
+        }
+        memcpy(&combined->text[files[i].textStartingLine], files[i].text,
+            files[i].textSize * sizeof(int));
+        memcpy(&combined->data[files[i].dataStartingLine], files[i].data,
+            files[i].dataSize * sizeof(int));
+    }
+
+    // 4) Resolve relocation entries in text or data
+    //    First every entry becomes a RelocationRecord, with the word it
+    //    patches and the address it needs. The records are then applied one
+    //    file at a time in parallel; each file only patches its own words.
+    struct RelocationContext *relocation = &link->relocation;
+    relocation->files = files;
+    relocation->combined = combined;
+    relocation->globals = &link->globals;
+    relocation->firstRecord = tryAllocate(numFiles + 1, sizeof(unsigned int));
+    if (relocation->firstRecord == NULL) {
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    for (i = 0; i < numFiles; i++) {
+        relocation->firstRecord[i + 1] = relocation->firstRecord[i] + files[i].relocationTableSize;
+    }
+    relocation->records = tryAllocate(relocation->firstRecord[numFiles], sizeof(RelocationRecord));
+    if (relocation->records == NULL) {
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    parallelFor(numFiles, options->threads, resolveRelocationsTask, relocation);
+    return 0;
+}
+
+// Finishes a link after linkSymbols(): the sections are copied into
+// link->combined with the veneers, and relocated there.
+int finishLink(struct Link *link, const lc2k_options *options, lc2k_diag *diag) {
+    if (resolveRelocations(link, options, diag)) {
+        return -1;
+    }
+    if (options->foldData && foldData(link, diag)) {
+        return -1;
+    }
+    if (checkRelocations(link, diag)) {
+        return -1;
+    }
+    for (unsigned int i = 0; i < link->numVeneers; i++) {
+        Veneer *veneer = &link->veneers[i];
+        encodeVeneer(veneer, &link->combined.text[veneer->stub]);
+        link->combined.text[veneer->poolWord] = veneer->target;
+    }
+    parallelFor(link->numFiles, options->threads, applyRelocationsTask, &link->relocation);
+    return 0;
+}
+
+int linkFiles(struct Link *link, const lc2k_options *options, lc2k_diag *diag) {
+    return linkSymbols(link, options, diag) || finishLink(link, options, diag) ? -1 : 0;
+}
+
+// Returns whether file lists label as undefined.
+static bool refersToUndefined(const FileData *file, LabelKey label) {
+    for (unsigned int j = 0; j < file->symbolTableSize; j++) {
+        if (file->symbolTable[j].location == 'U' && file->symbolTable[j].label == label) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Partial link (-r): merges link->files into the one relocatable object
+// the assembler would have written for all of their source. References the
+// files make to each other are resolved. A resolved beq is done with, but
+// lw, sw and .fill keep their relocation entries: the merged object still
+// moves in the final link. Labels none of the files define, Stack among
+// them, stay undefined. Returns 0, or -1 with the errors in *diag.
+int linkRelocatable(struct Link *link, const lc2k_options *options, FileData *out,
+        lc2k_diag *diag) {
+    unsigned int i, j;
+    if ((options->gc && collectGarbage(link, options, diag)) || defineGlobals(link, diag)
+            || resolveRelocations(link, options, diag)) {
+        return -1;
+    }
+    FileData *files = link->files;
+    RelocationRecord *records = link->relocation.records;
+    unsigned int numRecords = link->relocation.firstRecord[link->numFiles];
+    unsigned int numSymbols = 0;
+    for (i = 0; i < link->numFiles; i++) {
+        numSymbols += files[i].symbolTableSize;
+    }
+    bool *external = tryAllocate(numRecords, sizeof(bool));
+    SymbolHashTable undefined;
+    undefined.slots = NULL;
+    memset(out, 0, sizeof(*out));
+    out->symbolTable = tryAllocate(numSymbols, sizeof(SymbolTableEntry));
+    out->relocTable = tryAllocate(numRecords, sizeof(RelocationTableEntry));
+    if (!external || !out->symbolTable || !out->relocTable
+            || initSymbolHashTable(&undefined, numSymbols)) {
+        free(external);
+        free(undefined.slots);
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+
+    // References to labels no file defines are left for the final link
+    for (i = 0; i < link->numFiles; i++) {
+        RelocationRecord *record = &records[link->relocation.firstRecord[i]];
+        for (j = 0; j < files[i].relocationTableSize; j++, record++) {
+            LabelKey label = files[i].relocTable[j].label;
+            if (findSymbolAddress(&link->globals, label) < 0
+                    && refersToUndefined(&files[i], label)) {
+                external[record - records] = true;
+                record->kind = RELOC_NONE;
+            }
+        }
+    }
+    if (checkRelocations(link, diag)) {
+        free(undefined.slots);
+        free(external);
+        return -1;
+    }
+    parallelFor(link->numFiles, options->threads, applyRelocationsTask, &link->relocation);
+
+    for (i = 0; i < link->numFiles; i++) {
+        for (j = 0; j < files[i].symbolTableSize; j++) {
+            SymbolTableEntry *sym = &files[i].symbolTable[j];
+            SymbolTableEntry *merged = &out->symbolTable[out->symbolTableSize];
+            if (sym->location == 'U') {
+                if (findSymbolAddress(&link->globals, sym->label) < 0
+                        && insertGlobal(&undefined, sym->label, 0)) {
+                    *merged = *sym;
+                    out->symbolTableSize++;
+                }
+                continue;
+            }
+            *merged = *sym;
+            merged->offset += sym->location == 'T' ? files[i].textStartingLine
+                : sym->location == 'D' ? files[i].dataStartingLine : 0;
+            out->symbolTableSize++;
+        }
+        RelocationRecord *record = &records[link->relocation.firstRecord[i]];
+        for (j = 0; j < files[i].relocationTableSize; j++, record++) {
+            RelocationTableEntry *rel = &files[i].relocTable[j];
+            if (!external[record - records] && !strcmp(rel->inst, "beq")) {
+                continue;
+            }
+            RelocationTableEntry *merged = &out->relocTable[out->relocationTableSize++];
+            *merged = *rel;
+            merged->file = 0;
+            merged->offset += strcmp(rel->inst, ".fill") ? files[i].textStartingLine
+                : files[i].dataStartingLine;
+        }
+    }
+    out->textSize = link->combined.textSize;
+    out->dataSize = link->combined.dataSize;
+    out->text = link->combined.text;
+    out->data = link->combined.data;
+    link->combined.text = link->combined.data = NULL;
+    free(undefined.slots);
+    free(external);
+    return 0;
+}
+
+// Resolves the relocations of link->files[i] after linkSymbols() and
+// applies them to the file's own sections, so it can be written out
+// without the rest of the program in memory. records has room for the
+// file's relocation table. Returns 0, or -1 with the relocations out of
+// range in *diag.
+int relocateFile(struct Link *link, unsigned int i, RelocationRecord *records,
+        lc2k_diag *diag) {
+    FileData *file = &link->files[i];
+    unsigned int firstRecord[2] = {0, file->relocationTableSize};
+    struct RelocationContext one = {file, &link->combined, &link->globals, firstRecord, records};
+    resolveRelocationsTask(&one, 0);
+    int status = 0;
+    for (unsigned int j = 0; j < file->relocationTableSize; j++) {
+        status |= checkRelocation(file, &file->relocTable[j], &records[j], diag);
+    }
+    if (status) {
+        return -1;
+    }
+
+    // The records index the whole program; move them into this file. A
+    // beq keeps its distance as long as both ends move together.
+    CombinedFiles own = {.textSize = file->textSize, .dataSize = file->dataSize,
+        .text = file->text, .data = file->data};
+    for (unsigned int j = 0; j < file->relocationTableSize; j++) {
+        RelocationRecord record = records[j];
+        if (record.kind == RELOC_FILL) {
+            record.index -= file->dataStartingLine;
+        } else {
+            record.index -= file->textStartingLine;
+            if (record.kind == RELOC_BEQ) {
+                record.value -= file->textStartingLine;
+            }
+        }
+        applyRelocation(&own, &record);
+    }
+    return 0;
+}
+
+void freeLink(struct Link *link) {
+    for (unsigned int i = 0; i < link->numFiles; i++) {
+        freeFileData(&link->files[i]);
+    }
+    free(link->files);
+    free(link->combined.text);
+    free(link->combined.data);
+    free(link->globals.slots);
+    free(link->relocation.firstRecord);
+    free(link->relocation.records);
+    free(link->veneers);
+    free(link->textOrder);
+    free(link->dataOrder);
+    memset(link, 0, sizeof(*link));
+}
+
+struct ParseContext {
+	const lc2k_obj *objs;
+	FileData *files;
+};
+
+static void parseObjectTask(void *context, unsigned int index) {
+    struct ParseContext *parse = context;
+    const lc2k_obj *obj = &parse->objs[index];
+    struct ObjectReader reader = {obj->name, obj->contents, obj->contents + obj->size, 1};
+    parse->files[index].name = obj->name;
+    parseObjectFile(&reader, &parse->files[index], index, true);
+}
+
+int lc2k_link_with(const lc2k_obj *objs, size_t n, const lc2k_options *options,
+        lc2k_exe *out, lc2k_diag *diag) {
+    memset(out, 0, sizeof(*out));
+    memset(diag, 0, sizeof(*diag));
+    if (n == 0) {
+        return addDiagnostic(diag, "error: no object files to link\n");
+    }
+    struct Link link;
+    memset(&link, 0, sizeof(link));
+    link.files = tryAllocate(n, sizeof(FileData));
+    if (link.files == NULL) {
+        return addDiagnostic(diag, "error: out of memory\n");
+    }
+    link.numFiles = (unsigned int)n;
+    struct ParseContext parse = {objs, link.files};
+    parallelFor(link.numFiles, options->threads, parseObjectTask, &parse);
+    for (unsigned int i = 0; i < link.numFiles; i++) {
+        if (link.files[i].error[0] != '\0') {
+            addDiagnostic(diag, "%s", link.files[i].error);
+        }
+    }
+    if (diag->numErrors > 0 || linkFiles(&link, options, diag)) {
+        freeLink(&link);
+        return -1;
+    }
+    *out = link.combined;
+    link.combined.text = link.combined.data = NULL;
+    freeLink(&link);
+    return 0;
+}
+
+int lc2k_link(const lc2k_obj *objs, size_t n, lc2k_exe *out, lc2k_diag *diag) {
+    lc2k_options options = {.threads = 1};
+    return lc2k_link_with(objs, n, &options, out, diag);
+}
+
+void lc2k_exe_free(lc2k_exe *exe) {
+    free(exe->text);
+    free(exe->data);
+    memset(exe, 0, sizeof(*exe));
+}
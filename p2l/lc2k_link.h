@@ -0,0 +1,60 @@
+/**
+ * Project 2
+ * LC-2K linking as a library
+ *
+ * lc2k_link() links object files held in memory into an executable held in
+ * memory. It keeps no global state and never prints or exits, so several
+ * links can run at once on different threads. The linker command line is
+ * built on the same code.
+ */
+#ifndef LC2K_LINK_H
+#define LC2K_LINK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// An object file in the assembler's format
+typedef struct lc2k_obj {
+	const char *name;     // used in messages
+	const char *contents; // need not end with a 0 byte
+	size_t size;
+} lc2k_obj;
+
+// A linked program: the text words, then the data words
+typedef struct lc2k_exe {
+	unsigned int textSize;
+	unsigned int dataSize;
+	int *text;
+	int *data;
+	int stack; // address of the Stack label, the first word after the data
+} lc2k_exe;
+
+// Why a link failed, one "error: ..." line per problem
+typedef struct lc2k_diag {
+	unsigned int numErrors;
+	bool truncated;         // more errors than message has room for
+	char message[8192];
+} lc2k_diag;
+
+typedef struct lc2k_options {
+	bool gc;                       // drop the objects nothing refers to
+	const char *const *keepLabels; // extra roots for gc
+	unsigned int numKeepLabels;
+	bool foldData;                 // share identical read-only data runs
+	unsigned int threads;          // 0 for one per core
+	// Execution and access counts by address, from a run of the program
+	// linked without them. Objects are laid out hottest first. Not with
+	// foldData.
+	const unsigned long long *profile;
+	unsigned int profileSize;
+} lc2k_options;
+
+// Links the n objects in objs, the first one being main. Returns 0 with
+// the program in *out, to be freed with lc2k_exe_free(), or -1 with the
+// errors in *diag. lc2k_link() uses only the calling thread.
+int lc2k_link(const lc2k_obj *objs, size_t n, lc2k_exe *out, lc2k_diag *diag);
+int lc2k_link_with(const lc2k_obj *objs, size_t n, const lc2k_options *options,
+	lc2k_exe *out, lc2k_diag *diag);
+void lc2k_exe_free(lc2k_exe *exe);
+
+#endif
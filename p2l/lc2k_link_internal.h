@@ -0,0 +1,186 @@
+/**
+ * Project 2
+ * LC-2K linking internals
+ *
+ * What lc2k_link.c shares with the linker command line and nothing else.
+ * Programs using the library include lc2k_link.h only.
+ */
+#ifndef LC2K_LINK_INTERNAL_H
+#define LC2K_LINK_INTERNAL_H
+
+#include "lc2k_link.h"
+// Labels are LabelKeys, packed and unpacked with the assembler's
+// packLabel() and unpackLabel()
+#include "../p2a/lc2k.h"
+
+#define MAXLINELENGTH 1000
+
+// Registers a veneer uses, the same ones the assembler's long branches use
+#define SCRATCHREG 6
+#define RELAXLINKREG 7
+
+typedef struct FileData FileData;
+typedef struct SymbolTableEntry SymbolTableEntry;
+typedef struct RelocationTableEntry RelocationTableEntry;
+typedef struct lc2k_exe CombinedFiles;
+typedef struct GlobalSymbol GlobalSymbol;
+typedef struct SymbolHashTable SymbolHashTable;
+typedef struct RelocationRecord RelocationRecord;
+typedef struct Veneer Veneer;
+
+// 16 bytes, four to a cache line
+struct SymbolTableEntry {
+	LabelKey label;
+	unsigned int offset;
+	char location;
+};
+
+struct RelocationTableEntry {
+	LabelKey label;
+	unsigned int file;
+	unsigned int offset;
+	char inst[6];
+	bool veneer;         // a beq that goes through a veneer
+	unsigned int stub;   // and the text address of the veneer
+};
+
+struct FileData {
+	const char *name;
+	unsigned int textSize;
+	unsigned int dataSize;
+	unsigned int symbolTableSize;
+	unsigned int relocationTableSize;
+	unsigned int textStartingLine; // in final executable
+	unsigned int dataStartingLine; // in final executable
+	unsigned int dataFolded;       // data words sharing another run's copy
+	unsigned int numVeneers;       // laid out right after the text
+	long long sectionsOffset;      // bytes of the text and data words in
+	long long sectionsEnd;         // the file, for reading them later
+	// sized from the header line
+	int *text;
+	int *data;
+	SymbolTableEntry *symbolTable;
+	RelocationTableEntry *relocTable;
+	char error[MAXLINELENGTH]; // set if reading the file failed
+	long long fileSize;        // from stat, for incremental links
+	long long mtimeSec;
+	long long mtimeNsec;
+};
+
+// Open-addressing hash table from global label to final absolute address.
+struct GlobalSymbol {
+	LabelKey label; // 0 if the slot is empty
+	int address;
+};
+
+struct SymbolHashTable {
+	unsigned int capacity; // power of two
+	unsigned int count;
+	GlobalSymbol *slots;
+};
+
+// Cursor over an object file in memory. Lines are parsed in place.
+struct ObjectReader {
+	const char *inFileStr;
+	const char *pos;
+	const char *end;
+	unsigned int lineNumber; // of pos, for error messages
+};
+
+// What a relocation patches
+enum RelocationKind {
+	RELOC_NONE,       // nothing to do (beq to a label in the same file)
+	RELOC_BEQ,        // low 16 bits of a text word, relative to the next word
+	RELOC_ABSOLUTE16, // low 16 bits of a text word (lw, sw)
+	RELOC_FILL,       // a whole data word (.fill)
+	RELOC_POOL        // a whole text word (.pool, an address in a literal pool)
+};
+
+// A relocation resolved against the final layout
+struct RelocationRecord {
+	unsigned char kind; // enum RelocationKind
+	unsigned int index; // into combined.text, or combined.data for RELOC_FILL
+	int value;          // the absolute address of the label
+};
+
+struct RelocationContext {
+	FileData *files;
+	CombinedFiles *combined;
+	SymbolHashTable *globals;
+	unsigned int *firstRecord; // records of file i start at firstRecord[i]
+	RelocationRecord *records;
+};
+
+// A beq whose label is out of its reach goes to a veneer instead, laid out
+// after the text of its file: "lw 0 6 <pool word>" and "jalr 6 7", like the
+// assembler's long branches. The pool word holds the label's address; the
+// veneer pool follows the text of the first file, where lw can reach it.
+struct Veneer {
+	unsigned int file;       // of the beq
+	unsigned int relocation; // of the beq, in its file's table
+	unsigned int stub;       // text address of the lw, then the jalr
+	unsigned int poolWord;   // text address of the pool word
+	int target;
+};
+
+// Words per cache line when estimating the locality of a layout
+#define PROFILELINEWORDS 8
+
+// Everything a link builds, kept for the map and incremental state
+struct Link {
+	FileData *files; // compacted by gc
+	unsigned int numFiles;
+	CombinedFiles combined;
+	SymbolHashTable globals;
+	struct RelocationContext relocation;
+	bool collected;  // gc ran to completion
+	unsigned int numFilesRemoved, wordsRemoved;
+	unsigned int runsFolded, wordsFolded;
+	Veneer *veneers;
+	unsigned int numVeneers;
+	unsigned int veneerPool;   // text address of the first pool word
+	unsigned int layoutPasses; // more than one when veneers moved things
+	unsigned int *textOrder;   // files in address order, when a profile
+	unsigned int *dataOrder;   // reordered them; NULL for the input order
+	unsigned int hotTextLines[2], hotDataLines[2]; // before and after
+};
+
+int initSymbolHashTable(SymbolHashTable *table, unsigned int expected);
+int insertGlobal(SymbolHashTable *table, LabelKey label, int address);
+int findSymbolAddress(SymbolHashTable *table, LabelKey label);
+
+typedef void (*ParallelTask)(void *context, unsigned int index);
+void parallelFor(unsigned int count, unsigned int threads, ParallelTask task, void *context);
+
+int fileError(FileData *file, const char *format, ...);
+int endLine(struct ObjectReader *reader);
+int parseUnsigned(struct ObjectReader *reader, unsigned int *value);
+int parseWord(struct ObjectReader *reader, int *value);
+int parseToken(struct ObjectReader *reader, char *token, unsigned int maxLength);
+int parseLabel(struct ObjectReader *reader, LabelKey *label);
+int readerError(struct ObjectReader *reader, FileData *file, const char *expected);
+int parseObjectFile(struct ObjectReader *reader, FileData *file, unsigned int fileIndex,
+	bool sections);
+void freeFileData(FileData *file);
+
+void resolveRelocationsTask(void *context, unsigned int i);
+void applyRelocation(CombinedFiles *combined, const RelocationRecord *record);
+void applyRelocationsTask(void *context, unsigned int i);
+void encodeVeneer(const Veneer *veneer, int stub[2]);
+
+// Link link->files, which are parsed but not yet laid out. All return 0,
+// or -1 with the errors in *diag; freeLink() releases what they built
+// either way. linkSymbols() stops once the layout and globals are known and
+// doesn't need the files' sections. finishLink() then relocates the whole
+// program, or relocateFile() one file at a time; the veneers are not part
+// of any file. linkFiles() does both.
+int linkSymbols(struct Link *link, const lc2k_options *options, lc2k_diag *diag);
+int finishLink(struct Link *link, const lc2k_options *options, lc2k_diag *diag);
+int linkFiles(struct Link *link, const lc2k_options *options, lc2k_diag *diag);
+int relocateFile(struct Link *link, unsigned int i, RelocationRecord *records,
+	lc2k_diag *diag);
+int linkRelocatable(struct Link *link, const lc2k_options *options, FileData *out,
+	lc2k_diag *diag);
+void freeLink(struct Link *link);
+
+#endif
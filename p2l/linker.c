@@ -3,311 +3,2032 @@
  * LC-2K Linker
  */
 
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fs.h> // FICLONE, to reflink cached executables
+#endif
 
-#define MAXSIZE 500
-#define MAXLINELENGTH 1000
-#define MAXFILES 6
+#include "lc2k_link_internal.h"
+
+// Object files up to this size are read into a buffer on the stack, which
+// costs less than setting up and tearing down a mapping
+#define SMALLFILESIZE 16384
+
+// A profile covers at most the whole LC-2K memory
+#define MAXPROFILESIZE 65536
 
 static inline void printHexToFile(FILE *, int);
 
-typedef struct FileData FileData;
-typedef struct SymbolTableEntry SymbolTableEntry;
-typedef struct RelocationTableEntry RelocationTableEntry;
-typedef struct CombinedFiles CombinedFiles;
+// calloc that exits on failure; never returns NULL, even for 0 elements
+static void *allocate(size_t count, size_t size) {
+    void *memory = calloc(count ? count : 1, size);
+    if (memory == NULL) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// realloc that exits on failure
+static void *reallocate(void *memory, size_t count, size_t size) {
+    memory = realloc(memory, (count ? count : 1) * size);
+    if (memory == NULL) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+    return memory;
+}
+
+// initSymbolHashTable that exits on failure
+static void initHashTable(SymbolHashTable *table, unsigned int expected) {
+    if (initSymbolHashTable(table, expected)) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+}
+
+// The modification time of a file. Darwin calls the field st_mtimespec, or
+// splits it into st_mtime and st_mtimensec in POSIX mode.
+static struct timespec modificationTime(const struct stat *info) {
+#if defined(__APPLE__) && defined(_POSIX_C_SOURCE) && !defined(_DARWIN_C_SOURCE)
+    struct timespec time = {info->st_mtime, info->st_mtimensec};
+    return time;
+#elif defined(__APPLE__)
+    return info->st_mtimespec;
+#else
+    return info->st_mtim;
+#endif
+}
+
+// Reads one object file into file by mapping it and parsing the bytes in
+// place, with or without its sections. Returns 0, or -1 with file->error
+// set. Safe to run on several files at once.
+int readObjectFile(const char *inFileStr, FileData *file, unsigned int fileIndex, bool sections) {
+    file->name = inFileStr;
+    int fd = open(inFileStr, O_RDONLY);
+    if (fd < 0) {
+        return fileError(file, "error in opening %s\n", inFileStr);
+    }
+    struct stat info;
+    if (fstat(fd, &info) || info.st_size == 0) {
+        close(fd);
+        return fileError(file, "error: bad header line in %s\n", inFileStr);
+    }
+    file->fileSize = info.st_size;
+    struct timespec mtime = modificationTime(&info);
+    file->mtimeSec = mtime.tv_sec;
+    file->mtimeNsec = mtime.tv_nsec;
+    if (info.st_size <= SMALLFILESIZE) {
+        char buffer[SMALLFILESIZE];
+        ssize_t length = 0, count = 1;
+        while (length < info.st_size && count > 0) {
+            count = read(fd, buffer + length, info.st_size - length);
+            length += count > 0 ? count : 0;
+        }
+        close(fd);
+        if (length != info.st_size) {
+            return fileError(file, "error in reading %s\n", inFileStr);
+        }
+        struct ObjectReader reader = {inFileStr, buffer, buffer + length, 1};
+        return parseObjectFile(&reader, file, fileIndex, sections);
+    }
+    const char *contents = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (contents == MAP_FAILED) {
+        return fileError(file, "error in opening %s\n", inFileStr);
+    }
+    if (sections) {
+        posix_madvise((void *)contents, info.st_size, POSIX_MADV_SEQUENTIAL);
+    }
+    struct ObjectReader reader = {inFileStr, contents, contents + info.st_size, 1};
+    int status = parseObjectFile(&reader, file, fileIndex, sections);
+    munmap((void *)contents, info.st_size);
+    return status;
+}
 
-struct SymbolTableEntry {
-	char label[7];
-	char location;
-	unsigned int offset;
+// Second phase of reading a file read without its sections: reads only
+// the bytes of its text and data words, straight into text and data.
+// Returns 0, or -1 with file->error set.
+static int readSections(FileData *file, int *text, int *data) {
+    int fd = open(file->name, O_RDONLY);
+    if (fd < 0) {
+        return fileError(file, "error in opening %s\n", file->name);
+    }
+    struct stat info;
+    if (fstat(fd, &info) || info.st_size != file->fileSize
+            || modificationTime(&info).tv_sec != file->mtimeSec
+            || modificationTime(&info).tv_nsec != file->mtimeNsec) {
+        close(fd);
+        return fileError(file, "error: %s changed while linking\n", file->name);
+    }
+    size_t length = file->sectionsEnd - file->sectionsOffset;
+    char *buffer = allocate(length, 1);
+    size_t done = 0;
+    ssize_t count = 1;
+    while (done < length && count > 0) {
+        count = pread(fd, buffer + done, length - done, file->sectionsOffset + done);
+        done += count > 0 ? count : 0;
+    }
+    close(fd);
+    if (done != length) {
+        free(buffer);
+        return fileError(file, "error in reading %s\n", file->name);
+    }
+    struct ObjectReader reader = {file->name, buffer, buffer + length, 2};
+    int status = 0;
+    unsigned int j;
+    for (j = 0; status == 0 && j < file->textSize; j++) {
+        if (parseWord(&reader, &text[j])) {
+            status = readerError(&reader, file, "a text word");
+        }
+    }
+    for (j = 0; status == 0 && j < file->dataSize; j++) {
+        if (parseWord(&reader, &data[j])) {
+            status = readerError(&reader, file, "a data word");
+        }
+    }
+    if (status == 0 && reader.pos != reader.end) {
+        status = readerError(&reader, file, "a symbol table line (label, T/D/U, offset)");
+    }
+    free(buffer);
+    return status;
+}
+
+// Reads the sections of a file read without them into its own arrays.
+static int loadSections(FileData *file) {
+    file->text = allocate(file->textSize, sizeof(int));
+    file->data = allocate(file->dataSize, sizeof(int));
+    return readSections(file, file->text, file->data);
+}
+
+// Reads the sections of every file read without them, into combined if
+// it is given and into the files' own arrays if not.
+struct SectionContext {
+	FileData *files;
+	CombinedFiles *combined;
 };
 
-struct RelocationTableEntry {
-    unsigned int file;
-	unsigned int offset;
-	char inst[6];
-	char label[7];
+static void readSectionsTask(void *context, unsigned int i) {
+    struct SectionContext *load = context;
+    FileData *file = &load->files[i];
+    if (file->text != NULL) {
+        return;
+    } else if (load->combined == NULL) {
+        loadSections(file);
+    } else {
+        readSections(file, &load->combined->text[file->textStartingLine],
+            &load->combined->data[file->dataStartingLine]);
+    }
+}
+
+struct ReadContext {
+	char **fileNames;
+	FileData *files;
+	bool sections;
 };
 
-struct FileData {
-	unsigned int textSize;
-	unsigned int dataSize;
-	unsigned int symbolTableSize;
-	unsigned int relocationTableSize;
-	unsigned int textStartingLine; // in final executable
-	unsigned int dataStartingLine; // in final executable
-	int text[MAXSIZE];
-	int data[MAXSIZE];
-	SymbolTableEntry symbolTable[MAXSIZE];
-	RelocationTableEntry relocTable[MAXSIZE];
+static void readObjectTask(void *context, unsigned int index) {
+    struct ReadContext *read = context;
+    readObjectFile(read->fileNames[index], &read->files[index], index, read->sections);
+}
+
+// The inputs named on the command line, in response files and by --objdir
+struct InputList {
+	char **names;
+	unsigned int count;
+	unsigned int capacity;
 };
 
-struct CombinedFiles {
-	unsigned int textSize;
-	unsigned int dataSize;
-	unsigned int symbolTableSize;
-	unsigned int relocationTableSize;
-	int text[MAXSIZE * MAXFILES];
-	int data[MAXSIZE * MAXFILES];
-	SymbolTableEntry symbolTable[MAXSIZE * MAXFILES];
-	RelocationTableEntry relocTable[MAXSIZE * MAXFILES];
+static void addInput(struct InputList *inputs, char *name) {
+    if (inputs->count == inputs->capacity) {
+        inputs->capacity = inputs->capacity ? 2 * inputs->capacity : 64;
+        inputs->names = reallocate(inputs->names, inputs->capacity, sizeof(char *));
+    }
+    inputs->names[inputs->count++] = name;
+}
+
+// Adds the inputs listed in a response file (@file), one per line.
+// Blank lines are skipped. Returns 0, or -1 if the file can't be read.
+int readResponseFile(const char *listFileStr, struct InputList *inputs) {
+    char line[MAXLINELENGTH];
+    FILE *listFilePtr = fopen(listFileStr, "r");
+    if (listFilePtr == NULL) {
+        return -1;
+    }
+    while (fgets(line, MAXLINELENGTH, listFilePtr)) {
+        size_t length = strlen(line);
+        while (length > 0 && strchr(" \t\r\n", line[length - 1])) {
+            line[--length] = '\0';
+        }
+        char *name = line + strspn(line, " \t");
+        if (*name != '\0') {
+            addInput(inputs, strdup(name));
+        }
+    }
+    fclose(listFilePtr);
+    return 0;
+}
+
+// Reads a profile (--profile): one "<address> <count>" line per word a run
+// of the program used, executed or accessed, counting both. Addresses are
+// those of the program linked the same way without --profile; a word listed
+// twice adds up. Blank lines are skipped. Returns 0, -1 if the file can't be
+// read, or the number of a line that doesn't parse.
+static int readProfile(const char *profileFileStr, unsigned long long **counts,
+        unsigned int *size) {
+    char line[MAXLINELENGTH];
+    FILE *profileFilePtr = fopen(profileFileStr, "r");
+    if (profileFilePtr == NULL) {
+        return -1;
+    }
+    *counts = allocate(MAXPROFILESIZE, sizeof(unsigned long long));
+    *size = 0;
+    int lineNumber = 0, status = 0;
+    while (status == 0 && fgets(line, MAXLINELENGTH, profileFilePtr)) {
+        unsigned int address;
+        unsigned long long count;
+        char extra;
+        lineNumber++;
+        if (strspn(line, " \t\r\n") == strlen(line)) {
+            continue;
+        }
+        if (sscanf(line, "%u %llu %c", &address, &count, &extra) != 2
+                || address >= MAXPROFILESIZE) {
+            status = lineNumber;
+            continue;
+        }
+        (*counts)[address] += count;
+        *size = address >= *size ? address + 1 : *size;
+    }
+    fclose(profileFilePtr);
+    return status;
+}
+
+// Orders names with runs of digits compared by value, so prog_2.obj comes
+// before prog_10.obj
+static int compareInputNames(const void *a, const void *b) {
+    const char *x = *(char *const *)a, *y = *(char *const *)b;
+    while (*x && *y) {
+        if (*x >= '0' && *x <= '9' && *y >= '0' && *y <= '9') {
+            while (*x == '0') x++;
+            while (*y == '0') y++;
+            size_t digitsX = strspn(x, "0123456789"), digitsY = strspn(y, "0123456789");
+            if (digitsX != digitsY) {
+                return digitsX < digitsY ? -1 : 1;
+            }
+            int order = strncmp(x, y, digitsX);
+            if (order) {
+                return order;
+            }
+            x += digitsX;
+            y += digitsY;
+        } else if (*x != *y) {
+            return (unsigned char)*x < (unsigned char)*y ? -1 : 1;
+        } else {
+            x++;
+            y++;
+        }
+    }
+    return *x ? 1 : *y ? -1 : strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Adds every .obj file in a directory (--objdir), in name order.
+// Returns 0, or -1 if the directory can't be read.
+int addObjectDirectory(const char *dirStr, struct InputList *inputs) {
+    DIR *dir = opendir(dirStr);
+    if (dir == NULL) {
+        return -1;
+    }
+    struct InputList names = {NULL, 0, 0};
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        size_t length = strlen(entry->d_name);
+        if (length > 4 && !strcmp(entry->d_name + length - 4, ".obj")) {
+            addInput(&names, strdup(entry->d_name));
+        }
+    }
+    closedir(dir);
+    if (names.count > 0) {
+        qsort(names.names, names.count, sizeof(char *), compareInputNames);
+    }
+    for (unsigned int i = 0; i < names.count; i++) {
+        char *path = allocate(strlen(dirStr) + strlen(names.names[i]) + 2, 1);
+        sprintf(path, "%s/%s", dirStr, names.names[i]);
+        addInput(inputs, path);
+        free(names.names[i]);
+    }
+    free(names.names);
+    return 0;
+}
+
+static double elapsedMilliseconds(const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+// ---------------------------------------------------------------------------
+// Libraries, as written by the archiver
+//
+// A library is mapped and only its index is parsed. The members that define
+// a label still undefined are parsed straight out of the mapping, so the
+// pages of members nothing needs are never read.
+// ---------------------------------------------------------------------------
+
+#define LIBRARYMAGIC "!<lc2k-lib>"
+#define MAXMEMBERNAME 255
+
+struct LibraryMember {
+	char *name;           // "library(member)", for messages
+	const char *contents; // inside the library's mapping
+	unsigned int size;
+	bool selected;
 };
 
+struct LibrarySet {
+	unsigned int numLibraries;
+	unsigned int numMembers;
+	unsigned int numExports;
+	const char **mappings; // each library's whole file
+	size_t *mappingSizes;
+	struct LibraryMember *members;
+	LabelKey *exportLabels;
+	unsigned int *exportMembers;
+	SymbolHashTable exports; // label to member index, first library wins
+	char error[MAXLINELENGTH];
+};
 
+static int libraryError(struct LibrarySet *set, const char *libraryFileStr) {
+    snprintf(set->error, sizeof(set->error), "error: bad library index in %s\n", libraryFileStr);
+    return -1;
+}
+
+// Maps a library and adds its members and exported labels to set.
+// Returns 0, or -1 with set->error set.
+int readLibrary(const char *libraryFileStr, struct LibrarySet *set) {
+    unsigned int i, numMembers, numExports;
+    int fd = open(libraryFileStr, O_RDONLY);
+    if (fd < 0) {
+        snprintf(set->error, sizeof(set->error), "error in opening %s\n", libraryFileStr);
+        return -1;
+    }
+    struct stat info;
+    if (fstat(fd, &info) || info.st_size == 0) {
+        close(fd);
+        return libraryError(set, libraryFileStr);
+    }
+    const char *contents = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (contents == MAP_FAILED) {
+        snprintf(set->error, sizeof(set->error), "error in opening %s\n", libraryFileStr);
+        return -1;
+    }
+    set->mappings = reallocate(set->mappings, set->numLibraries + 1, sizeof(char *));
+    set->mappingSizes = reallocate(set->mappingSizes, set->numLibraries + 1, sizeof(size_t));
+    set->mappings[set->numLibraries] = contents;
+    set->mappingSizes[set->numLibraries] = info.st_size;
+    set->numLibraries++;
+
+    struct ObjectReader reader = {libraryFileStr, contents, contents + info.st_size, 1};
+    size_t magicLength = strlen(LIBRARYMAGIC);
+    if ((size_t)info.st_size <= magicLength || memcmp(contents, LIBRARYMAGIC, magicLength)) {
+        return libraryError(set, libraryFileStr);
+    }
+    reader.pos += magicLength;
+    if (endLine(&reader) || parseUnsigned(&reader, &numMembers)
+            || parseUnsigned(&reader, &numExports) || endLine(&reader)) {
+        return libraryError(set, libraryFileStr);
+    }
+
+    // Member offsets are relative to the end of the index, so keep them
+    // until the index has been read
+    unsigned int firstMember = set->numMembers;
+    unsigned int *offsets = allocate(numMembers, sizeof(unsigned int));
+    set->members = reallocate(set->members, firstMember + numMembers,
+        sizeof(struct LibraryMember));
+    for (i = 0; i < numMembers; i++) {
+        struct LibraryMember *member = &set->members[set->numMembers];
+        char name[MAXMEMBERNAME + 1];
+        if (parseToken(&reader, name, MAXMEMBERNAME) || parseUnsigned(&reader, &offsets[i])
+                || parseUnsigned(&reader, &member->size) || endLine(&reader)) {
+            free(offsets);
+            return libraryError(set, libraryFileStr);
+        }
+        member->name = allocate(strlen(libraryFileStr) + strlen(name) + 3, 1);
+        sprintf(member->name, "%s(%s)", libraryFileStr, name);
+        member->selected = false;
+        set->numMembers++;
+    }
+    set->exportLabels = reallocate(set->exportLabels, set->numExports + numExports,
+        sizeof(LabelKey));
+    set->exportMembers = reallocate(set->exportMembers, set->numExports + numExports,
+        sizeof(unsigned int));
+    for (i = 0; i < numExports; i++) {
+        unsigned int member;
+        if (parseLabel(&reader, &set->exportLabels[set->numExports])
+                || parseUnsigned(&reader, &member) || endLine(&reader) || member >= numMembers) {
+            free(offsets);
+            return libraryError(set, libraryFileStr);
+        }
+        set->exportMembers[set->numExports++] = firstMember + member;
+    }
+    for (i = 0; i < numMembers; i++) {
+        struct LibraryMember *member = &set->members[firstMember + i];
+        if ((unsigned long long)offsets[i] + member->size > (size_t)(reader.end - reader.pos)) {
+            free(offsets);
+            return libraryError(set, libraryFileStr);
+        }
+        member->contents = reader.pos + offsets[i];
+    }
+    free(offsets);
+    return 0;
+}
+
+// Indexes the exported labels of every library read. Called once all
+// libraries are read, so the table can be sized for all of them.
+void indexLibraryExports(struct LibrarySet *set) {
+    initHashTable(&set->exports, set->numExports);
+    for (unsigned int i = 0; i < set->numExports; i++) {
+        insertGlobal(&set->exports, set->exportLabels[i], set->exportMembers[i]);
+    }
+}
+
+struct MemberContext {
+	struct LibrarySet *set;
+	unsigned int *memberIndices;
+	FileData *files;          // the first member's FileData
+	unsigned int firstFile;   // its index among all files
+};
+
+static void readMemberTask(void *context, unsigned int index) {
+    struct MemberContext *read = context;
+    struct LibraryMember *member = &read->set->members[read->memberIndices[index]];
+    struct ObjectReader reader = {member->name, member->contents,
+        member->contents + member->size, 1};
+    read->files[index].name = member->name;
+    parseObjectFile(&reader, &read->files[index], read->firstFile + index, true);
+}
+
+// Adds the library members that define a label the files refer to but
+// don't define, then the members those refer to, until nothing changes.
+// Only the labels of newly added files need checking each round: the
+// exports index covers every label a member defines.
+void pullInLibraryMembers(FileData **files, unsigned int *numFiles,
+        struct LibrarySet *set) {
+    unsigned int i, j;
+    unsigned int numDefinitions = set->numExports;
+    for (i = 0; i < *numFiles; i++) {
+        numDefinitions += (*files)[i].symbolTableSize;
+    }
+    SymbolHashTable defined;
+    initHashTable(&defined, numDefinitions);
+    unsigned int *selected = allocate(set->numMembers, sizeof(unsigned int));
+
+    unsigned int firstNew = 0;
+    while (firstNew < *numFiles) {
+        for (i = firstNew; i < *numFiles; i++) {
+            FileData *file = &(*files)[i];
+            for (j = 0; j < file->symbolTableSize; j++) {
+                if (file->symbolTable[j].location != 'U') {
+                    insertGlobal(&defined, file->symbolTable[j].label, 0);
+                }
+            }
+        }
+        unsigned int numSelected = 0;
+        for (i = firstNew; i < *numFiles; i++) {
+            FileData *file = &(*files)[i];
+            for (j = 0; j < file->symbolTableSize; j++) {
+                SymbolTableEntry *sym = &file->symbolTable[j];
+                if (sym->location != 'U' || findSymbolAddress(&defined, sym->label) >= 0) {
+                    continue;
+                }
+                int member = findSymbolAddress(&set->exports, sym->label);
+                if (member >= 0 && !set->members[member].selected) {
+                    set->members[member].selected = true;
+                    selected[numSelected++] = member;
+                }
+            }
+        }
+
+        firstNew = *numFiles;
+        *numFiles += numSelected;
+        *files = reallocate(*files, *numFiles, sizeof(FileData));
+        memset(&(*files)[firstNew], 0, numSelected * sizeof(FileData));
+        struct MemberContext memberContext = {set, selected, &(*files)[firstNew], firstNew};
+        parallelFor(numSelected, 0, readMemberTask, &memberContext);
+        for (i = 0; i < numSelected; i++) {
+            printf("pulling in %s\n", (*files)[firstNew + i].name);
+            if ((*files)[firstNew + i].error[0] != '\0') {
+                printf("%s", (*files)[firstNew + i].error);
+                exit(1);
+            }
+        }
+    }
+
+    for (i = 0; i < set->numLibraries; i++) {
+        munmap((void *)set->mappings[i], set->mappingSizes[i]);
+    }
+    free(selected);
+    free(defined.slots);
+}
+
+// Writes a relocatable object (-r) in the format the assembler writes.
+// Returns 0 or -1.
+int writeObjectFile(const char *outFileStr, const FileData *object) {
+    FILE *outFilePtr = fopen(outFileStr, "w");
+    if (outFilePtr == NULL) {
+        return -1;
+    }
+    unsigned int i;
+    char label[MAXLABELLENGTH + 1];
+    fprintf(outFilePtr, "%u %u %u %u\n", object->textSize, object->dataSize,
+        object->symbolTableSize, object->relocationTableSize);
+    for (i = 0; i < object->textSize; i++) {
+        printHexToFile(outFilePtr, object->text[i]);
+    }
+    for (i = 0; i < object->dataSize; i++) {
+        printHexToFile(outFilePtr, object->data[i]);
+    }
+    for (i = 0; i < object->symbolTableSize; i++) {
+        const SymbolTableEntry *sym = &object->symbolTable[i];
+        fprintf(outFilePtr, "%s %c %u\n", unpackLabel(sym->label, label), sym->location,
+            sym->offset);
+    }
+    for (i = 0; i < object->relocationTableSize; i++) {
+        const RelocationTableEntry *rel = &object->relocTable[i];
+        fprintf(outFilePtr, "%u %s %s\n", rel->offset, rel->inst, unpackLabel(rel->label, label));
+    }
+    return fclose(outFilePtr) ? -1 : 0;
+}
+
+// Writes the link map (--map): one line per record, fields separated by
+// spaces, names last since they are the only field that may hold spaces.
+//   text <size>
+//   data <size> <address>
+//   stack <address>
+//   object <index> <text address> <text size> <data address> <data size> <relocations> <name>
+//   symbol <address> <T|D> <object index> <label>
+//   veneer <stub address> <pool word address> <target address> <object index> <label>
+// Symbols follow the object that defines them, veneers the object whose
+// beq goes through them. Returns 0 or -1.
+int writeLinkMap(const char *mapFileStr, FileData *files, unsigned int numFiles,
+        const CombinedFiles *combined, SymbolHashTable *globals, const Veneer *veneers,
+        unsigned int numVeneers) {
+    FILE *mapFilePtr = fopen(mapFileStr, "w");
+    if (mapFilePtr == NULL) {
+        return -1;
+    }
+    fprintf(mapFilePtr, "text %u\ndata %u %u\nstack %d\n", combined->textSize,
+        combined->dataSize, combined->textSize, findSymbolAddress(globals, packLabel("Stack")));
+    for (unsigned int i = 0; i < numFiles; i++) {
+        FileData *file = &files[i];
+        fprintf(mapFilePtr, "object %u %u %u %u %u %u %s\n", i, file->textStartingLine,
+            file->textSize, combined->textSize + file->dataStartingLine,
+            file->dataSize - file->dataFolded,
+            file->relocationTableSize, file->name);
+        for (unsigned int j = 0; j < file->symbolTableSize; j++) {
+            SymbolTableEntry *sym = &file->symbolTable[j];
+            char label[MAXLABELLENGTH + 1];
+            if (sym->location != 'U') {
+                fprintf(mapFilePtr, "symbol %d %c %u %s\n", findSymbolAddress(globals, sym->label),
+                    sym->location, i, unpackLabel(sym->label, label));
+            }
+        }
+        for (; numVeneers > 0 && veneers->file == i; veneers++, numVeneers--) {
+            char label[MAXLABELLENGTH + 1];
+            fprintf(mapFilePtr, "veneer %u %u %d %u %s\n", veneers->stub, veneers->poolWord,
+                veneers->target, i,
+                unpackLabel(file->relocTable[veneers->relocation].label, label));
+        }
+    }
+    return fclose(mapFilePtr) ? -1 : 0;
+}
+
+// Binary executable images (--binary). A header page is followed by every
+// word as 32-bit little-endian, text then data. The words start on a page
+// boundary so a loader can map them straight into simulated memory.
+//   0  magic "LC2KIMG\0"
+//   8  version
+//   12 text size, in words
+//   16 data size, in words
+//   20 Stack address
+//   24 entry point
+//   28 offset of the first word
+// All header fields are 32-bit little-endian; the rest of the page is zero.
+#define IMAGEMAGIC "LC2KIMG"
+#define IMAGEVERSION 1
+#define IMAGEPAGESIZE 4096
+
+static void putLittleEndian(unsigned char *bytes, unsigned int word) {
+    bytes[0] = word & 0xFF;
+    bytes[1] = (word >> 8) & 0xFF;
+    bytes[2] = (word >> 16) & 0xFF;
+    bytes[3] = (word >> 24) & 0xFF;
+}
+
+static unsigned int getLittleEndian(const unsigned char *bytes) {
+    return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (unsigned int)bytes[3] << 24;
+}
+
+// Fills in the header page, which has to be zeroed.
+static void putImageHeader(unsigned char *page, const CombinedFiles *combined) {
+    memcpy(page, IMAGEMAGIC, sizeof(IMAGEMAGIC));
+    putLittleEndian(page + 8, IMAGEVERSION);
+    putLittleEndian(page + 12, combined->textSize);
+    putLittleEndian(page + 16, combined->dataSize);
+    putLittleEndian(page + 20, combined->textSize + combined->dataSize);
+    putLittleEndian(page + 24, 0);
+    putLittleEndian(page + 28, IMAGEPAGESIZE);
+}
+
+static int writeBinaryImage(FILE *outFilePtr, const CombinedFiles *combined) {
+    unsigned int numWords = combined->textSize + combined->dataSize;
+    size_t size = IMAGEPAGESIZE + (size_t)numWords * 4;
+    unsigned char *image = allocate(size, 1);
+    putImageHeader(image, combined);
+    unsigned char *word = image + IMAGEPAGESIZE;
+    unsigned int i;
+    for (i = 0; i < combined->textSize; i++, word += 4) {
+        putLittleEndian(word, combined->text[i]);
+    }
+    for (i = 0; i < combined->dataSize; i++, word += 4) {
+        putLittleEndian(word, combined->data[i]);
+    }
+    int status = fwrite(image, 1, size, outFilePtr) == size ? 0 : -1;
+    free(image);
+    return status;
+}
+
+// Reads the words of a binary image into combined, whose sizes have to
+// match the header. Returns 0 or -1.
+static int readBinaryImage(const unsigned char *image, size_t size, CombinedFiles *combined) {
+    unsigned int i;
+    if (size < IMAGEPAGESIZE || getLittleEndian(image + 8) != IMAGEVERSION
+            || getLittleEndian(image + 12) != combined->textSize
+            || getLittleEndian(image + 16) != combined->dataSize
+            || getLittleEndian(image + 28) != IMAGEPAGESIZE
+            || size != IMAGEPAGESIZE + 4 * (size_t)(combined->textSize + combined->dataSize)) {
+        return -1;
+    }
+    const unsigned char *word = image + IMAGEPAGESIZE;
+    for (i = 0; i < combined->textSize; i++, word += 4) {
+        combined->text[i] = getLittleEndian(word);
+    }
+    for (i = 0; i < combined->dataSize; i++, word += 4) {
+        combined->data[i] = getLittleEndian(word);
+    }
+    return 0;
+}
+
+// Formats words the way they appear in the executable: 11-byte
+// "0xXXXXXXXX\n" lines, or 4-byte words for a binary image.
+static void formatWords(unsigned char *out, const int *words, unsigned int count, bool binary) {
+    static const char digits[] = "0123456789ABCDEF";
+    for (unsigned int i = 0; i < count; i++) {
+        unsigned int word = (unsigned int)words[i];
+        if (binary) {
+            putLittleEndian(out, word);
+            out += 4;
+            continue;
+        }
+        *out++ = '0';
+        *out++ = 'x';
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            *out++ = digits[(word >> shift) & 0xF];
+        }
+        *out++ = '\n';
+    }
+}
+
+static int writeAll(int fd, const unsigned char *bytes, size_t length, off_t offset) {
+    while (length > 0) {
+        ssize_t count = pwrite(fd, bytes, length, offset);
+        if (count <= 0) {
+            return -1;
+        }
+        bytes += count;
+        length -= count;
+        offset += count;
+    }
+    return 0;
+}
+
+// Words formatted and written by one task of a parallel write
+#define WRITECHUNKWORDS 4096
+
+struct WriteContext {
+	int fd;
+	const CombinedFiles *combined;
+	bool binary;
+	int *status; // of each chunk
+};
+
+// Formats one chunk of the executable's words, text then data, and writes
+// it to its place in the file.
+static void writeChunkTask(void *context, unsigned int chunk) {
+    struct WriteContext *job = context;
+    const CombinedFiles *combined = job->combined;
+    unsigned int numWords = combined->textSize + combined->dataSize;
+    unsigned int first = chunk * WRITECHUNKWORDS;
+    unsigned int last = numWords - first > WRITECHUNKWORDS ? first + WRITECHUNKWORDS : numWords;
+    size_t wordSize = job->binary ? 4 : 11;
+    off_t base = job->binary ? IMAGEPAGESIZE : 0;
+    unsigned char *buffer = allocate(last - first, wordSize);
+    unsigned char *out = buffer;
+    unsigned int word = first;
+    if (word < combined->textSize) {
+        unsigned int count = (last < combined->textSize ? last : combined->textSize) - word;
+        formatWords(out, &combined->text[word], count, job->binary);
+        out += count * wordSize;
+        word += count;
+    }
+    formatWords(out, &combined->data[word - combined->textSize], last - word, job->binary);
+    job->status[chunk] = writeAll(job->fd, buffer, (last - first) * wordSize,
+        base + (off_t)first * wordSize);
+    free(buffer);
+}
+
+// Writes the executable the way writeExecutable() does, byte for byte.
+// Every word's place in the file is known, so the file is allocated at its
+// full size up front and chunks of words are formatted and written on
+// every core at once. Returns 0 or -1.
+static int writeExecutableParallel(const char *outFileStr, const CombinedFiles *combined,
+        bool binary) {
+    int fd = open(outFileStr, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        return -1;
+    }
+    unsigned int numWords = combined->textSize + combined->dataSize;
+    off_t size = (binary ? IMAGEPAGESIZE : 0) + (off_t)numWords * (binary ? 4 : 11);
+    // a file system that can't allocate ahead still gets the size set, and
+    // so does a system without posix_fallocate (macOS)
+#ifdef __linux__
+    bool allocated = size > 0 && posix_fallocate(fd, 0, size) == 0;
+#else
+    bool allocated = false;
+#endif
+    if (size > 0 && !allocated && ftruncate(fd, size)) {
+        close(fd);
+        return -1;
+    }
+    int status = 0;
+    if (binary) {
+        unsigned char *header = allocate(IMAGEPAGESIZE, 1);
+        putImageHeader(header, combined);
+        status = writeAll(fd, header, IMAGEPAGESIZE, 0);
+        free(header);
+    }
+    unsigned int numChunks = (numWords + WRITECHUNKWORDS - 1) / WRITECHUNKWORDS;
+    int *chunkStatus = allocate(numChunks, sizeof(int));
+    struct WriteContext job = {fd, combined, binary, chunkStatus};
+    parallelFor(numChunks, 0, writeChunkTask, &job);
+    for (unsigned int i = 0; i < numChunks; i++) {
+        status |= chunkStatus[i];
+    }
+    free(chunkStatus);
+    return close(fd) || status ? -1 : 0;
+}
+
+// Writes the executable: text words, then data words, as machine code
+// text or as a binary image, in parallel with --parallel-write. Returns 0
+// or -1.
+int writeExecutable(const char *outFileStr, const CombinedFiles *combined, bool binary,
+        bool parallel) {
+    if (parallel) {
+        return writeExecutableParallel(outFileStr, combined, binary);
+    }
+    FILE *outFilePtr = fopen(outFileStr, "w");
+    if (outFilePtr == NULL) {
+        return -1;
+    }
+    if (binary) {
+        int status = writeBinaryImage(outFilePtr, combined);
+        return fclose(outFilePtr) || status ? -1 : 0;
+    }
+    unsigned int i;
+    for (i = 0; i < combined->textSize; i++) {
+        printHexToFile(outFilePtr, combined->text[i]);
+    }
+    for (i = 0; i < combined->dataSize; i++) {
+        printHexToFile(outFilePtr, combined->data[i]);
+    }
+    return fclose(outFilePtr) ? -1 : 0;
+}
+
+// Writes the executable of a link done with linkSymbols() (--stream). Every
+// word has a fixed size and its place follows from the layout, so each file
+// is loaded, relocated and written straight to its place in turn; only one
+// file's sections are in memory at a time. Returns 0 or -1.
+int streamExecutable(const char *outFileStr, struct Link *link, bool binary) {
+    int fd = open(outFileStr, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        return -1;
+    }
+    unsigned int i, largest = 0, maxRelocations = 0;
+    for (i = 0; i < link->numFiles; i++) {
+        FileData *file = &link->files[i];
+        largest = file->textSize > largest ? file->textSize : largest;
+        largest = file->dataSize > largest ? file->dataSize : largest;
+        if (file->relocationTableSize > maxRelocations) {
+            maxRelocations = file->relocationTableSize;
+        }
+    }
+    size_t wordSize = binary ? 4 : 11;
+    off_t base = binary ? IMAGEPAGESIZE : 0;
+    unsigned char *buffer = allocate(binary && largest * 4 < IMAGEPAGESIZE
+        ? IMAGEPAGESIZE : largest * wordSize, 1);
+    RelocationRecord *records = allocate(maxRelocations, sizeof(RelocationRecord));
+    int status = 0;
+    if (binary) {
+        putImageHeader(buffer, &link->combined);
+        status = writeAll(fd, buffer, IMAGEPAGESIZE, 0);
+    }
+    for (i = 0; status == 0 && i < link->numFiles; i++) {
+        FileData *file = &link->files[i];
+        if (file->text == NULL && loadSections(file)) {
+            printf("%s", file->error);
+            exit(1);
+        }
+        lc2k_diag diag;
+        memset(&diag, 0, sizeof(diag));
+        if (relocateFile(link, i, records, &diag)) {
+            printf("%s", diag.message);
+            exit(1);
+        }
+        formatWords(buffer, file->text, file->textSize, binary);
+        status = writeAll(fd, buffer, file->textSize * wordSize,
+            base + (off_t)file->textStartingLine * wordSize);
+        formatWords(buffer, file->data, file->dataSize, binary);
+        if (status == 0) {
+            status = writeAll(fd, buffer, file->dataSize * wordSize,
+                base + (off_t)(link->combined.textSize + file->dataStartingLine) * wordSize);
+        }
+        free(file->text);
+        free(file->data);
+        file->text = file->data = NULL;
+    }
+    for (i = 0; status == 0 && i < link->numVeneers; i++) {
+        Veneer *veneer = &link->veneers[i];
+        int stub[2];
+        encodeVeneer(veneer, stub);
+        formatWords(buffer, stub, 2, binary);
+        status = writeAll(fd, buffer, 2 * wordSize, base + (off_t)veneer->stub * wordSize);
+        formatWords(buffer, &veneer->target, 1, binary);
+        if (status == 0) {
+            status = writeAll(fd, buffer, wordSize, base + (off_t)veneer->poolWord * wordSize);
+        }
+    }
+    free(records);
+    free(buffer);
+    return close(fd) || status ? -1 : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Link cache (--cache <dir>)
 //
-// Helper: find symbol in combined symbol table
-// Returns the absolute address if found, or -1 if not found.
-// 
-int findSymbolAddress(CombinedFiles *combined, const char *label) {
-    for (unsigned int i = 0; i < combined->symbolTableSize; i++) {
-        if (!strcmp(combined->symbolTable[i].label, label)) {
-            // If location == 'T', address is text offset
-            // If location == 'D', address is textSize + data offset
-            if (combined->symbolTable[i].location == 'T') {
-                return combined->symbolTable[i].offset; 
-            } else if (combined->symbolTable[i].location == 'D') {
-                return (combined->textSize + combined->symbolTable[i].offset);
+// Executables are kept in a directory under a key hashed from the linker
+// options and the contents of every input, in order. On a hit the cached
+// executable is reflinked or copied to the output instead of linking. The
+// directory is kept under --cache-size bytes by evicting the least recently
+// used entries; using an entry touches its modification time. The hit and
+// miss counts are kept in the directory's "stats" file.
+// ---------------------------------------------------------------------------
+
+#define CACHEVERSION "lc2k-link-cache 1"
+#define DEFAULTCACHESIZE (64u << 20)
+
+// Two independent 64-bit hashes, for a 128-bit key
+struct CacheKey {
+	unsigned long long fnv;   // FNV-1a
+	unsigned long long mixed; // multiply and rotate
+};
+
+static void initCacheKey(struct CacheKey *key) {
+    key->fnv = 14695981039346656037ull;
+    key->mixed = 0x243F6A8885A308D3ull;
+}
+
+static void addToCacheKey(struct CacheKey *key, const void *data, size_t length) {
+    const unsigned char *bytes = data;
+    unsigned long long fnv = key->fnv, mixed = key->mixed;
+    for (size_t i = 0; i < length; i++) {
+        fnv = (fnv ^ bytes[i]) * 1099511628211ull;
+        mixed = (mixed ^ bytes[i]) * 0x9E3779B97F4A7C15ull;
+        mixed = mixed << 23 | mixed >> 41;
+    }
+    key->fnv = fnv;
+    key->mixed = mixed;
+}
+
+// Adds a string and its terminator, so consecutive strings can't run together.
+static void addStringToCacheKey(struct CacheKey *key, const char *string) {
+    addToCacheKey(key, string, strlen(string) + 1);
+}
+
+struct CacheInputContext {
+	char **names;
+	struct CacheKey *keys; // of each input's contents
+	bool *failed;
+};
+
+static void hashCacheInputTask(void *context, unsigned int i) {
+    struct CacheInputContext *hash = context;
+    struct CacheKey *key = &hash->keys[i];
+    initCacheKey(key);
+    int fd = open(hash->names[i], O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info)) {
+        hash->failed[i] = true;
+        if (fd >= 0) {
+            close(fd);
+        }
+        return;
+    }
+    unsigned long long size = info.st_size;
+    addToCacheKey(key, &size, sizeof(size));
+    if (info.st_size > 0) {
+        const char *contents = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (contents == MAP_FAILED) {
+            hash->failed[i] = true;
+        } else {
+            addToCacheKey(key, contents, info.st_size);
+            munmap((void *)contents, info.st_size);
+        }
+    }
+    close(fd);
+}
+
+// Computes the key of a link from the options that change the executable
+// and the inputs in link order. Returns 0, or -1 if an input can't be read.
+int computeCacheKey(struct CacheKey *key, char **inputNames, unsigned int numInputs,
+        const char *options) {
+    struct CacheInputContext hash = {
+        inputNames, allocate(numInputs, sizeof(struct CacheKey)), allocate(numInputs, sizeof(bool))
+    };
+    parallelFor(numInputs, 0, hashCacheInputTask, &hash);
+    initCacheKey(key);
+    addStringToCacheKey(key, CACHEVERSION);
+    addStringToCacheKey(key, options);
+    int status = 0;
+    for (unsigned int i = 0; i < numInputs; i++) {
+        status |= hash.failed[i] ? -1 : 0;
+        addToCacheKey(key, &hash.keys[i], sizeof(struct CacheKey));
+    }
+    free(hash.keys);
+    free(hash.failed);
+    return status;
+}
+
+static char *cachePath(const char *cacheDir, const char *name) {
+    char *path = allocate(strlen(cacheDir) + strlen(name) + 2, 1);
+    sprintf(path, "%s/%s", cacheDir, name);
+    return path;
+}
+
+// Copies a file, sharing its blocks when the file system can reflink.
+// Returns 0 or -1.
+static int copyFile(const char *fromFileStr, const char *toFileStr) {
+    int from = open(fromFileStr, O_RDONLY);
+    if (from < 0) {
+        return -1;
+    }
+    int to = open(toFileStr, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (to < 0) {
+        close(from);
+        return -1;
+    }
+    int status = -1;
+#ifdef FICLONE
+    status = ioctl(to, FICLONE, from) == 0 ? 0 : -1;
+#endif
+    if (status) {
+        char buffer[65536];
+        ssize_t count;
+        status = 0;
+        while ((count = read(from, buffer, sizeof(buffer))) > 0) {
+            for (ssize_t written = 0; written < count; ) {
+                ssize_t n = write(to, buffer + written, count - written);
+                if (n <= 0) {
+                    status = -1;
+                    break;
+                }
+                written += n;
+            }
+            if (status) {
+                break;
             }
         }
+        status = count < 0 ? -1 : status;
     }
-    return -1;
+    close(from);
+    return close(to) || status ? -1 : 0;
 }
 
-int main(int argc, char *argv[]) {
-	char *inFileStr, *outFileStr;
-	FILE *inFilePtr, *outFilePtr; 
-	unsigned int i, j;
+// Adds one to the hit or miss count and returns both.
+static void countCacheLookup(const char *cacheDir, bool hit, unsigned long long *hits,
+        unsigned long long *misses) {
+    char *statsFileStr = cachePath(cacheDir, "stats");
+    *hits = *misses = 0;
+    int fd = open(statsFileStr, O_RDWR | O_CREAT, 0666);
+    free(statsFileStr);
+    if (fd < 0) {
+        return;
+    }
+    // other links may share the cache, so update the counts under a lock
+    struct flock lock;
+    memset(&lock, 0, sizeof(lock));
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    fcntl(fd, F_SETLKW, &lock);
+    char line[MAXLINELENGTH];
+    ssize_t length = read(fd, line, sizeof(line) - 1);
+    line[length > 0 ? length : 0] = '\0';
+    if (sscanf(line, "hits %llu misses %llu", hits, misses) != 2) {
+        *hits = *misses = 0;
+    }
+    *(hit ? hits : misses) += 1;
+    length = snprintf(line, sizeof(line), "hits %llu misses %llu\n", *hits, *misses);
+    if (pwrite(fd, line, length, 0) == length) {
+        ftruncate(fd, length);
+    }
+    close(fd); // releases the lock
+}
 
-    if (argc <= 2 || argc > 8 ) {
-        printf("error: usage: %s <MAIN-object-file> ... <object-file> ... <output-exe-file>, with at most 5 object files\n",
-				argv[0]);
-		exit(1);
-	}
+// Copies the cached executable for key to the output. Returns 1 on a hit.
+int lookUpLinkCache(const char *cacheDir, const char *entryName, const char *outFileStr) {
+    char *entryFileStr = cachePath(cacheDir, entryName);
+    int hit = copyFile(entryFileStr, outFileStr) == 0;
+    if (hit) {
+        utimensat(AT_FDCWD, entryFileStr, NULL, 0); // now most recently used
+    }
+    free(entryFileStr);
+    return hit;
+}
 
-	outFileStr = argv[argc - 1];
+struct CacheEntry {
+	char *path;
+	long long size;
+	struct timespec used;
+};
 
-	outFilePtr = fopen(outFileStr, "w");
-	if (outFilePtr == NULL) {
-		printf("error in opening %s\n", outFileStr);
-		exit(1);
-	}
+static int compareCacheEntries(const void *a, const void *b) {
+    const struct CacheEntry *x = a, *y = b;
+    if (x->used.tv_sec != y->used.tv_sec) {
+        return x->used.tv_sec < y->used.tv_sec ? -1 : 1;
+    }
+    return x->used.tv_nsec < y->used.tv_nsec ? -1 : x->used.tv_nsec > y->used.tv_nsec;
+}
 
-	FileData files[MAXFILES];
-	CombinedFiles combined;
-	memset(&combined, 0, sizeof(CombinedFiles));
+// Removes the least recently used entries until the cache fits in maxBytes.
+static void evictCacheEntries(const char *cacheDir, unsigned long long maxBytes) {
+    DIR *dir = opendir(cacheDir);
+    if (dir == NULL) {
+        return;
+    }
+    unsigned int numEntries = 0, capacity = 64;
+    struct CacheEntry *entries = allocate(capacity, sizeof(struct CacheEntry));
+    unsigned long long total = 0;
+    struct dirent *dirEntry;
+    while ((dirEntry = readdir(dir)) != NULL) {
+        size_t length = strlen(dirEntry->d_name);
+        struct stat info;
+        if (length < 4 || strcmp(dirEntry->d_name + length - 4, ".exe")) {
+            continue;
+        }
+        char *path = cachePath(cacheDir, dirEntry->d_name);
+        if (stat(path, &info)) {
+            free(path);
+            continue;
+        }
+        if (numEntries == capacity) {
+            capacity *= 2;
+            entries = reallocate(entries, capacity, sizeof(struct CacheEntry));
+        }
+        entries[numEntries].path = path;
+        entries[numEntries].size = info.st_size;
+        entries[numEntries].used = modificationTime(&info);
+        numEntries++;
+        total += info.st_size;
+    }
+    closedir(dir);
+    qsort(entries, numEntries, sizeof(struct CacheEntry), compareCacheEntries);
+    for (unsigned int i = 0; i < numEntries; i++) {
+        if (total > maxBytes && unlink(entries[i].path) == 0) {
+            total -= entries[i].size;
+        }
+        free(entries[i].path);
+    }
+    free(entries);
+}
 
-  // read in all files and combine into a "master" file
-	for (i = 0; i < argc - 2; ++i) {
-		inFileStr = argv[i+1];
+// Adds the executable just written to the cache, then evicts down to maxBytes.
+void storeInLinkCache(const char *cacheDir, const char *entryName, const char *outFileStr,
+        unsigned long long maxBytes) {
+    char *entryFileStr = cachePath(cacheDir, entryName);
+    // written under a unique name and renamed, so readers never see half of it
+    char *tempFileStr = allocate(strlen(entryFileStr) + 32, 1);
+    sprintf(tempFileStr, "%s.%ld.tmp", entryFileStr, (long)getpid());
+    if (copyFile(outFileStr, tempFileStr) || rename(tempFileStr, entryFileStr)) {
+        unlink(tempFileStr);
+        printf("warning: could not add %s to the link cache\n", outFileStr);
+    }
+    free(tempFileStr);
+    free(entryFileStr);
+    evictCacheEntries(cacheDir, maxBytes);
+}
 
-		inFilePtr = fopen(inFileStr, "r");
-		printf("opening %s\n", inFileStr);
+// ---------------------------------------------------------------------------
+// Incremental linking (--incremental)
+//
+// A full link saves its layout next to the output in <output>.state: where
+// each object went, the address of every global, and every relocation site
+// that refers to a global. The next incremental link only re-reads the
+// objects whose contents changed. If they kept their section sizes and
+// exported labels, their words are copied over the previous executable, their
+// own relocations are applied again, and so are the sites in other objects
+// that refer to a global that moved. Anything else falls back to a full link.
+// ---------------------------------------------------------------------------
 
-		if (inFilePtr == NULL) {
-			printf("error in opening %s\n", inFileStr);
-			exit(1);
-		}
+#define STATEMAGIC "lc2k-link-state 1"
 
-		char line[MAXLINELENGTH];
-		unsigned int textSize, dataSize, symbolTableSize, relocationTableSize;
-
-		// parse first line of file
-		fgets(line, MAXSIZE, inFilePtr);
-		sscanf(line, "%d %d %d %d",
-				&textSize, &dataSize, &symbolTableSize, &relocationTableSize);
-
-		files[i].textSize = textSize;
-		files[i].dataSize = dataSize;
-		files[i].symbolTableSize = symbolTableSize;
-		files[i].relocationTableSize = relocationTableSize;
-
-		// read in text section
-		int instr;
-		for (j = 0; j < textSize; ++j) {
-			fgets(line, MAXLINELENGTH, inFilePtr);
-			instr = strtol(line, NULL, 0);
-			files[i].text[j] = instr;
-		}
+struct StateObject {
+	char *path;
+	unsigned int textStartingLine;
+	unsigned int dataStartingLine;
+	unsigned int textSize;
+	unsigned int dataSize;
+	long long fileSize;
+	long long mtimeSec;
+	long long mtimeNsec;
+	unsigned long long hash; // of the file's contents
+};
 
-		// read in data section
-		int data;
-		for (j = 0; j < dataSize; ++j) {
-			fgets(line, MAXLINELENGTH, inFilePtr);
-			data = strtol(line, NULL, 0);
-			files[i].data[j] = data;
-		}
+struct StateGlobal {
+	LabelKey label;
+	int file; // defining object, -1 for Stack
+	int address;
+};
 
-		// read in the symbol table
-		char label[7];
-		char type;
-		unsigned int addr;
-		for (j = 0; j < symbolTableSize; ++j) {
-			fgets(line, MAXLINELENGTH, inFilePtr);
-			sscanf(line, "%s %c %d",
-					label, &type, &addr);
-			files[i].symbolTable[j].offset = addr;
-			strcpy(files[i].symbolTable[j].label, label);
-			files[i].symbolTable[j].location = type;
-		}
+// A relocation that refers to a global
+struct StateSite {
+	unsigned int file;
+	unsigned int kind; // enum RelocationKind
+	unsigned int index;
+	LabelKey label;
+};
 
-		// read in relocation table
-		char opcode[7];
-		for (j = 0; j < relocationTableSize; ++j) {
-			fgets(line, MAXLINELENGTH, inFilePtr);
-			sscanf(line, "%d %s %s",
-					&addr, opcode, label);
-			files[i].relocTable[j].offset = addr;
-			strcpy(files[i].relocTable[j].inst, opcode);
-			strcpy(files[i].relocTable[j].label, label);
-			files[i].relocTable[j].file	= i;
-		}
-		fclose(inFilePtr);
-	} // end reading files
+struct LinkState {
+	unsigned int numObjects;
+	unsigned int numGlobals;
+	unsigned int numSites;
+	unsigned int textSize;
+	unsigned int dataSize;
+	unsigned long long outputHash;
+	struct StateObject *objects;
+	struct StateGlobal *globals;
+	struct StateSite *sites;
+};
 
-	// *** INSERT YOUR CODE BELOW ***
-	//    Begin the linking process
-	//    Happy coding!!!
-	// -----------------------------------------------------
-	// 1) Merge the text and data sections in order:
-	//    - We'll record where each file's text & data now starts
-	//    - Then copy them into the combined text[] and data[] arrays
-	// -----------------------------------------------------
-	// 2) Merge text and data sections in the order read
-    unsigned int currentTextStart = 0;
-    unsigned int currentDataStart = 0;
-    for (i = 0; i < (unsigned int)(argc - 2); i++) {
-        files[i].textStartingLine = currentTextStart;
-        files[i].dataStartingLine = currentDataStart;
-
-        // Copy text
-        for (j = 0; j < files[i].textSize; j++) {
-            combined.text[currentTextStart + j] = files[i].text[j];
-        }
-        // Copy data
-        for (j = 0; j < files[i].dataSize; j++) {
-            combined.data[currentDataStart + j] = files[i].data[j];
-        }
-
-        currentTextStart += files[i].textSize;
-        currentDataStart += files[i].dataSize;
-    }
-    combined.textSize = currentTextStart;
-    combined.dataSize = currentDataStart;
-
-    // 3) Build global symbol table (skip 'U')
-    for (i = 0; i < (unsigned int)(argc - 2); i++) {
+// FNV-1a, 64 bit
+static unsigned long long hashBytes(const char *bytes, size_t length) {
+    unsigned long long hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// Hashes the contents of a file. Returns 0, or -1 if it can't be read.
+static int hashFile(const char *path, unsigned long long *hash) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat info;
+    if (fstat(fd, &info)) {
+        close(fd);
+        return -1;
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        *hash = hashBytes("", 0);
+        return 0;
+    }
+    const char *contents = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (contents == MAP_FAILED) {
+        return -1;
+    }
+    *hash = hashBytes(contents, info.st_size);
+    munmap((void *)contents, info.st_size);
+    return 0;
+}
+
+static void freeLinkState(struct LinkState *state) {
+    for (unsigned int i = 0; i < state->numObjects; i++) {
+        free(state->objects[i].path);
+    }
+    free(state->objects);
+    free(state->globals);
+    free(state->sites);
+    memset(state, 0, sizeof(*state));
+}
+
+// Reads a state file. Returns 0, or -1 if it is missing or malformed.
+static int loadLinkState(const char *stateFileStr, struct LinkState *state) {
+    char line[MAXLINELENGTH];
+    unsigned int i;
+    memset(state, 0, sizeof(*state));
+    FILE *stateFilePtr = fopen(stateFileStr, "r");
+    if (stateFilePtr == NULL) {
+        return -1;
+    }
+    if (!fgets(line, MAXLINELENGTH, stateFilePtr) || strncmp(line, STATEMAGIC "\n", MAXLINELENGTH)
+            || !fgets(line, MAXLINELENGTH, stateFilePtr)
+            || sscanf(line, "%u %u %u %u %u %llx", &state->numObjects, &state->numGlobals,
+                &state->numSites, &state->textSize, &state->dataSize, &state->outputHash) != 6) {
+        fclose(stateFilePtr);
+        return -1;
+    }
+    unsigned int numObjects = state->numObjects;
+    state->numObjects = 0; // counts the paths to free if reading stops early
+    state->objects = allocate(numObjects, sizeof(struct StateObject));
+    state->globals = allocate(state->numGlobals, sizeof(struct StateGlobal));
+    state->sites = allocate(state->numSites, sizeof(struct StateSite));
+    for (i = 0; i < numObjects; i++) {
+        struct StateObject *object = &state->objects[i];
+        int pathStart = 0;
+        if (!fgets(line, MAXLINELENGTH, stateFilePtr)
+                || sscanf(line, "%u %u %u %u %lld %lld %lld %llx %n", &object->textStartingLine,
+                    &object->dataStartingLine, &object->textSize, &object->dataSize,
+                    &object->fileSize, &object->mtimeSec, &object->mtimeNsec, &object->hash,
+                    &pathStart) != 8 || pathStart == 0) {
+            break;
+        }
+        line[strcspn(line, "\n")] = '\0';
+        object->path = strdup(line + pathStart);
+        state->numObjects++;
+    }
+    char label[MAXLABELLENGTH + 1];
+    for (i = 0; state->numObjects == numObjects && i < state->numGlobals; i++) {
+        struct StateGlobal *global = &state->globals[i];
+        if (!fgets(line, MAXLINELENGTH, stateFilePtr)
+                || sscanf(line, "%6s %d %d", label, &global->file, &global->address) != 3) {
+            break;
+        }
+        global->label = packLabel(label);
+    }
+    bool complete = state->numObjects == numObjects && i == state->numGlobals;
+    for (i = 0; complete && i < state->numSites; i++) {
+        struct StateSite *site = &state->sites[i];
+        if (!fgets(line, MAXLINELENGTH, stateFilePtr)
+                || sscanf(line, "%u %u %u %6s", &site->file, &site->kind, &site->index,
+                    label) != 4 || site->file >= numObjects) {
+            complete = false;
+        } else {
+            site->label = packLabel(label);
+        }
+    }
+    fclose(stateFilePtr);
+    if (!complete) {
+        freeLinkState(state);
+        return -1;
+    }
+    return 0;
+}
+
+// Writes a state file. A state that can't be saved only costs the next
+// incremental link a full link, so failures are reported and ignored.
+static void saveLinkState(const char *stateFileStr, const struct LinkState *state) {
+    unsigned int i;
+    char label[MAXLABELLENGTH + 1];
+    FILE *stateFilePtr = fopen(stateFileStr, "w");
+    if (stateFilePtr == NULL) {
+        printf("warning: could not write %s\n", stateFileStr);
+        return;
+    }
+    fprintf(stateFilePtr, "%s\n%u %u %u %u %u %llx\n", STATEMAGIC, state->numObjects,
+        state->numGlobals, state->numSites, state->textSize, state->dataSize, state->outputHash);
+    for (i = 0; i < state->numObjects; i++) {
+        const struct StateObject *object = &state->objects[i];
+        fprintf(stateFilePtr, "%u %u %u %u %lld %lld %lld %llx %s\n", object->textStartingLine,
+            object->dataStartingLine, object->textSize, object->dataSize, object->fileSize,
+            object->mtimeSec, object->mtimeNsec, object->hash, object->path);
+    }
+    for (i = 0; i < state->numGlobals; i++) {
+        const struct StateGlobal *global = &state->globals[i];
+        fprintf(stateFilePtr, "%s %d %d\n", unpackLabel(global->label, label), global->file,
+            global->address);
+    }
+    for (i = 0; i < state->numSites; i++) {
+        const struct StateSite *site = &state->sites[i];
+        fprintf(stateFilePtr, "%u %u %u %s\n", site->file, site->kind, site->index,
+            unpackLabel(site->label, label));
+    }
+    if (fclose(stateFilePtr)) {
+        printf("warning: could not write %s\n", stateFileStr);
+    }
+}
+
+static void setStateObject(struct StateObject *object, const FileData *file) {
+    object->textStartingLine = file->textStartingLine;
+    object->dataStartingLine = file->dataStartingLine;
+    object->textSize = file->textSize;
+    object->dataSize = file->dataSize;
+    object->fileSize = file->fileSize;
+    object->mtimeSec = file->mtimeSec;
+    object->mtimeNsec = file->mtimeNsec;
+}
+
+// Appends the sites of file's relocations that refer to globals.
+static void addStateSites(struct LinkState *state, unsigned int fileIndex, const FileData *file,
+        const RelocationRecord *records, SymbolHashTable *globals) {
+    for (unsigned int j = 0; j < file->relocationTableSize; j++) {
+        const RelocationTableEntry *rel = &file->relocTable[j];
+        if (records[j].kind == RELOC_NONE || findSymbolAddress(globals, rel->label) < 0) {
+            continue;
+        }
+        struct StateSite *site = &state->sites[state->numSites++];
+        site->file = fileIndex;
+        site->kind = records[j].kind;
+        site->index = records[j].index;
+        site->label = rel->label;
+    }
+}
+
+// Saves the state of a full link, after the executable has been written.
+static void saveFullLinkState(const char *stateFileStr, const char *outFileStr,
+        FileData *files, unsigned int numFiles,
+        const CombinedFiles *combined, SymbolHashTable *globals,
+        const struct RelocationContext *relocation) {
+    struct LinkState state;
+    unsigned int i, j;
+    memset(&state, 0, sizeof(state));
+    state.textSize = combined->textSize;
+    state.dataSize = combined->dataSize;
+    state.objects = allocate(numFiles, sizeof(struct StateObject));
+    state.globals = allocate(globals->count, sizeof(struct StateGlobal));
+    state.sites = allocate(relocation->firstRecord[numFiles], sizeof(struct StateSite));
+    if (hashFile(outFileStr, &state.outputHash)) {
+        free(state.objects);
+        free(state.globals);
+        free(state.sites);
+        printf("warning: could not write %s\n", stateFileStr);
+        return;
+    }
+    for (i = 0; i < numFiles; i++) {
+        struct StateObject *object = &state.objects[state.numObjects++];
+        object->path = strdup(files[i].name);
+        setStateObject(object, &files[i]);
+        if (hashFile(files[i].name, &object->hash)) {
+            object->fileSize = -1; // never matches, so the object is reread
+        }
         for (j = 0; j < files[i].symbolTableSize; j++) {
             SymbolTableEntry *sym = &files[i].symbolTable[j];
+            if (sym->location != 'U') {
+                struct StateGlobal *global = &state.globals[state.numGlobals++];
+                global->label = sym->label;
+                global->file = i;
+                global->address = findSymbolAddress(globals, sym->label);
+            }
+        }
+        addStateSites(&state, i, &files[i], &relocation->records[relocation->firstRecord[i]],
+            globals);
+    }
+    struct StateGlobal *stack = &state.globals[state.numGlobals++];
+    stack->label = packLabel("Stack");
+    stack->file = -1;
+    stack->address = findSymbolAddress(globals, stack->label);
+    saveLinkState(stateFileStr, &state);
+    freeLinkState(&state);
+}
+
+// Reads the previous executable, text or binary, into combined, which is
+// sized from state.
+static int readExecutable(const char *outFileStr, CombinedFiles *combined) {
+    int fd = open(outFileStr, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat info;
+    if (fstat(fd, &info) || info.st_size == 0) {
+        close(fd);
+        return combined->textSize + combined->dataSize == 0 ? 0 : -1;
+    }
+    const char *contents = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (contents == MAP_FAILED) {
+        return -1;
+    }
+    if ((size_t)info.st_size >= sizeof(IMAGEMAGIC)
+            && !memcmp(contents, IMAGEMAGIC, sizeof(IMAGEMAGIC))) {
+        int status = readBinaryImage((const unsigned char *)contents, info.st_size, combined);
+        munmap((void *)contents, info.st_size);
+        return status;
+    }
+    struct ObjectReader reader = {outFileStr, contents, contents + info.st_size, 1};
+    int status = 0;
+    unsigned int i;
+    for (i = 0; status == 0 && i < combined->textSize; i++) {
+        status = parseWord(&reader, &combined->text[i]);
+    }
+    for (i = 0; status == 0 && i < combined->dataSize; i++) {
+        status = parseWord(&reader, &combined->data[i]);
+    }
+    if (reader.pos != reader.end) {
+        status = -1;
+    }
+    munmap((void *)contents, info.st_size);
+    return status;
+}
+
+// Links incrementally against the state of the last link. Returns 1 once
+// the executable is written, or 0 if a full link is needed.
+static int incrementalLink(char **fileNames, unsigned int numFiles, const char *outFileStr,
+        const char *stateFileStr, bool binary, bool parallelWrite) {
+    struct LinkState state;
+    unsigned int i, j;
+    if (loadLinkState(stateFileStr, &state)) {
+        printf("incremental: no usable link state, doing a full link\n");
+        return 0;
+    }
+    const char *reason = NULL;
+    if (state.numObjects != numFiles) {
+        reason = "the object files changed";
+    }
+    for (i = 0; reason == NULL && i < numFiles; i++) {
+        if (strcmp(state.objects[i].path, fileNames[i])) {
+            reason = "the object files changed";
+        }
+    }
+    unsigned long long outputHash;
+    if (reason == NULL && (hashFile(outFileStr, &outputHash) || outputHash != state.outputHash)) {
+        reason = "the executable changed since the last link";
+    }
+
+    // Find the objects whose contents changed. Size and modification time
+    // are checked first so that untouched objects are never read.
+    unsigned int numChanged = 0;
+    unsigned int *changed = allocate(numFiles, sizeof(unsigned int));
+    bool *isChanged = allocate(numFiles, sizeof(bool));
+    for (i = 0; reason == NULL && i < numFiles; i++) {
+        struct StateObject *object = &state.objects[i];
+        struct stat info;
+        unsigned long long hash;
+        if (stat(fileNames[i], &info)) {
+            reason = "an object file is missing";
+        } else if (info.st_size == object->fileSize
+                && modificationTime(&info).tv_sec == object->mtimeSec
+                && modificationTime(&info).tv_nsec == object->mtimeNsec) {
+            continue;
+        } else if (hashFile(fileNames[i], &hash)) {
+            reason = "an object file is missing";
+        } else if (hash == object->hash) {
+            object->fileSize = info.st_size;
+            object->mtimeSec = modificationTime(&info).tv_sec;
+            object->mtimeNsec = modificationTime(&info).tv_nsec;
+        } else {
+            object->hash = hash;
+            isChanged[i] = true;
+            changed[numChanged++] = i;
+        }
+    }
+
+    FileData *files = allocate(numChanged, sizeof(FileData));
+    for (i = 0; reason == NULL && i < numChanged; i++) {
+        printf("opening %s\n", fileNames[changed[i]]);
+        if (readObjectFile(fileNames[changed[i]], &files[i], i, true)) {
+            printf("%s", files[i].error);
+            exit(1);
+        }
+        struct StateObject *object = &state.objects[changed[i]];
+        if (files[i].textSize != object->textSize || files[i].dataSize != object->dataSize) {
+            reason = "an object file changed size";
+        }
+        files[i].textStartingLine = object->textStartingLine;
+        files[i].dataStartingLine = object->dataStartingLine;
+    }
+
+    // The previous globals, by label; address holds the index into state.globals
+    SymbolHashTable byLabel;
+    initHashTable(&byLabel, state.numGlobals);
+    for (i = 0; i < state.numGlobals; i++) {
+        insertGlobal(&byLabel, state.globals[i].label, i);
+    }
+    // A changed object has to export exactly the labels it did before, and
+    // may only refer to globals that still exist
+    bool *moved = allocate(state.numGlobals, sizeof(bool));
+    for (i = 0; reason == NULL && i < numChanged; i++) {
+        unsigned int exported = 0;
+        for (j = 0; reason == NULL && j < files[i].symbolTableSize; j++) {
+            SymbolTableEntry *sym = &files[i].symbolTable[j];
+            int index = findSymbolAddress(&byLabel, sym->label);
             if (sym->location == 'U') {
-                // 'U' means undefined reference => not a definition
+                if (index < 0) {
+                    reason = "an object file refers to a new global";
+                }
                 continue;
             }
-            // check duplicates
-            for (unsigned int k = 0; k < combined.symbolTableSize; k++) {
-                if (!strcmp(combined.symbolTable[k].label, sym->label)) {
-                    printf("error: duplicate label '%s' found in multiple files\n",
-                           sym->label);
-                    exit(1);
-                }
+            if (index < 0 || state.globals[index].file != (int)changed[i]
+                    || (sym->location != 'T' && sym->location != 'D')) {
+                reason = "an object file changed its global labels";
+                continue;
             }
-            // no duplicate => add
-            strcpy(combined.symbolTable[combined.symbolTableSize].label, sym->label);
-            combined.symbolTable[combined.symbolTableSize].location = sym->location;
-            if (sym->location == 'T') {
-                combined.symbolTable[combined.symbolTableSize].offset =
-                    files[i].textStartingLine + sym->offset;
-            } 
-            else if (sym->location == 'D') {
-                combined.symbolTable[combined.symbolTableSize].offset =
-                    files[i].dataStartingLine + sym->offset;
-            } 
-            else {
-                // If there's some other letter, assume we keep the offset as is
-                combined.symbolTable[combined.symbolTableSize].offset = sym->offset;
+            int address = sym->location == 'T' ? files[i].textStartingLine + sym->offset
+                : state.textSize + files[i].dataStartingLine + sym->offset;
+            if (address != state.globals[index].address) {
+                state.globals[index].address = address;
+                moved[index] = true;
             }
-            combined.symbolTableSize++;
+            exported++;
+        }
+        for (j = 0; reason == NULL && j < state.numGlobals; j++) {
+            if (state.globals[j].file == (int)changed[i]) {
+                exported--;
+            }
+        }
+        if (reason == NULL && exported != 0) {
+            reason = "an object file changed its global labels";
         }
     }
 
-    // 4) Resolve relocation entries in text or data
-    for (i = 0; i < (unsigned int)(argc - 2); i++) {
-        for (j = 0; j < files[i].relocationTableSize; j++) {
-            RelocationTableEntry *rel = &files[i].relocTable[j];
+    if (reason == NULL) {
+        CombinedFiles combined = {.textSize = state.textSize, .dataSize = state.dataSize,
+            .text = allocate(state.textSize, sizeof(int)),
+            .data = allocate(state.dataSize, sizeof(int))};
+        if (readExecutable(outFileStr, &combined)) {
+            reason = "the executable could not be read";
+        }
+        SymbolHashTable globals;
+        initHashTable(&globals, state.numGlobals);
+        for (i = 0; i < state.numGlobals; i++) {
+            insertGlobal(&globals, state.globals[i].label, state.globals[i].address);
+        }
 
-            // First find the symbol's final absolute address
-            int symbolAddr = findSymbolAddress(&combined, rel->label);
-			if (symbolAddr < 0) {
-				// The symbol isn’t in the global table, so assume it's a local label.
-				// For a text-section relocation, add the file’s textStartingLine to the immediate value.
-				int localOffset = combined.text[files[i].textStartingLine + rel->offset] & 0xFFFF;
-				symbolAddr = files[i].textStartingLine + localOffset;
-			}
+        // Copy the changed objects over their old words and relocate them
+        unsigned int *firstRecord = allocate(numChanged + 1, sizeof(unsigned int));
+        for (i = 0; i < numChanged; i++) {
+            firstRecord[i + 1] = firstRecord[i] + files[i].relocationTableSize;
+            memcpy(&combined.text[files[i].textStartingLine], files[i].text,
+                files[i].textSize * sizeof(int));
+            memcpy(&combined.data[files[i].dataStartingLine], files[i].data,
+                files[i].dataSize * sizeof(int));
+        }
+        struct RelocationContext relocation = {
+            files, &combined, &globals, firstRecord,
+            allocate(firstRecord[numChanged], sizeof(RelocationRecord))
+        };
+        parallelFor(numChanged, 0, resolveRelocationsTask, &relocation);
+        parallelFor(numChanged, 0, applyRelocationsTask, &relocation);
+        unsigned int reapplied = firstRecord[numChanged];
 
-            /*
-             * Now figure out if this relocation offset refers to TEXT or DATA.
-             *   If rel->inst == ".fill", it means data offset
-             *   Otherwise, it’s likely an instruction offset (lw, sw, beq, etc.)
-             */
-            if (!strcmp(rel->inst, ".fill")) {
-                // data fix-up
-                unsigned int finalDataIndex = files[i].dataStartingLine + rel->offset;
-                // For a .fill of a label, we store the absolute address.
-                combined.data[finalDataIndex] = symbolAddr;
+        // Sites in the other objects only need patching if their global
+        // moved. The changed objects' sites are replaced by their new ones.
+        struct StateSite *oldSites = state.sites;
+        unsigned int numOldSites = state.numSites;
+        state.sites = allocate(numOldSites + firstRecord[numChanged], sizeof(struct StateSite));
+        state.numSites = 0;
+        for (i = 0; i < numOldSites; i++) {
+            struct StateSite *site = &oldSites[i];
+            if (isChanged[site->file]) {
+                continue;
             }
-            else {
-                // text fix-up
-                unsigned int finalInstrIndex = files[i].textStartingLine + rel->offset;
-                int instr = combined.text[finalInstrIndex];
-
-                if (!strcmp(rel->inst, "beq")) {
-                    // beq offset = symbolAddr - (PC+1)
-                    int offset = symbolAddr - ((int)finalInstrIndex + 1);
-                    // Clear old 16 bits, insert offset
-                    instr &= 0xFFFF0000;
-                    instr |= (offset & 0xFFFF);
-                }
-                else if (!strcmp(rel->inst, "lw") || !strcmp(rel->inst, "sw")) {
-                    // place absolute address in bottom 16 bits
-                    instr &= 0xFFFF0000;
-                    instr |= (symbolAddr & 0xFFFF);
-                }
-                // else handle more instructions if needed
+            int index = findSymbolAddress(&byLabel, site->label);
+            if (index >= 0 && moved[index]) {
+                RelocationRecord record = {site->kind, site->index, state.globals[index].address};
+                applyRelocation(&combined, &record);
+                reapplied++;
+            }
+            state.sites[state.numSites++] = *site;
+        }
+        free(oldSites);
+        for (i = 0; i < numChanged; i++) {
+            setStateObject(&state.objects[changed[i]], &files[i]);
+            addStateSites(&state, changed[i], &files[i], &relocation.records[firstRecord[i]],
+                &globals);
+        }
 
-                combined.text[finalInstrIndex] = instr;
+        if (reason == NULL && numChanged > 0
+                && writeExecutable(outFileStr, &combined, binary, parallelWrite)) {
+            printf("error in opening %s\n", outFileStr);
+            exit(1);
+        }
+        if (reason == NULL) {
+            if (hashFile(outFileStr, &state.outputHash)) {
+                state.outputHash = 0;
             }
+            saveLinkState(stateFileStr, &state);
+            printf("incremental: relinked %u of %u objects, reapplied %u relocations\n",
+                numChanged, numFiles, reapplied);
         }
+        free(relocation.records);
+        free(firstRecord);
+        free(globals.slots);
+        free(combined.text);
+        free(combined.data);
+    }
+    if (reason != NULL) {
+        printf("incremental: %s, doing a full link\n", reason);
     }
 
-    // 5) Insert "Stack" label at first free location after text & data
-    {
-        const char *stackLabel = "Stack";
-        // check if it's already defined
-        for (unsigned int k = 0; k < combined.symbolTableSize; k++) {
-            if (!strcmp(combined.symbolTable[k].label, stackLabel)) {
-                printf("error: 'Stack' label already defined\n");
-                exit(1);
-            }
+    for (i = 0; i < numChanged; i++) {
+        free(files[i].text);
+        free(files[i].data);
+        free(files[i].symbolTable);
+        free(files[i].relocTable);
+    }
+    free(files);
+    free(moved);
+    free(byLabel.slots);
+    free(isChanged);
+    free(changed);
+    freeLinkState(&state);
+    return reason == NULL;
+}
+
+// Prints the errors of files that failed to read, and exits if there are any.
+static void exitOnFileErrors(FileData *files, unsigned int numFiles) {
+    bool failed = false;
+    for (unsigned int i = 0; i < numFiles; i++) {
+        if (files[i].error[0] != '\0') {
+            printf("%s", files[i].error);
+            failed = true;
         }
-        // add it
-        strcpy(combined.symbolTable[combined.symbolTableSize].label, stackLabel);
-        combined.symbolTable[combined.symbolTableSize].location = 'D'; 
-        combined.symbolTable[combined.symbolTableSize].offset = combined.dataSize;
-        combined.symbolTableSize++;
     }
+    if (failed) {
+        exit(1);
+    }
+}
 
-    // 6) Write out final machine code
-    //    text instructions first, then data
-    for (i = 0; i < combined.textSize; i++) {
-        printHexToFile(outFilePtr, combined.text[i]);
+// Prints what the link reported, and exits if it failed.
+static void exitOnDiagnostics(const lc2k_diag *diag, int status) {
+    printf("%s", diag->message);
+    if (diag->truncated) {
+        printf("error: more errors than can be shown\n");
     }
-    for (i = 0; i < combined.dataSize; i++) {
-        printHexToFile(outFilePtr, combined.data[i]);
+    if (status) {
+        exit(1);
     }
+}
 
-    fclose(outFilePtr);
-    return 0;
+int main(int argc, char *argv[]) {
+	char *outFileStr;
+	unsigned int i;
+	bool incremental = false;
+	bool gc = false;
+	bool foldData = false;
+	bool stream = false;
+	bool relocatable = false;
+	char *mapFileStr = NULL;
+	char **keepLabels = allocate(argc, sizeof(char *));
+	unsigned int numKeepLabels = 0;
+
+	// Options come first; the rest are the inputs and the output
+	char **objDirs = allocate(argc, sizeof(char *));
+	unsigned int numObjDirs = 0;
+	bool stats = false;
+	bool binary = false;
+	bool parallelWrite = false;
+	char *profileFileStr = NULL;
+	char *cacheDir = NULL;
+	unsigned long long cacheSize = DEFAULTCACHESIZE;
+	int argi = 1;
+	for (; argi < argc && argv[argi][0] == '-'; argi++) {
+		if (!strcmp(argv[argi], "--incremental")) {
+			incremental = true;
+		} else if (!strcmp(argv[argi], "--gc")) {
+			gc = true;
+		} else if (!strcmp(argv[argi], "--fold-data")) {
+			foldData = true;
+		} else if (!strcmp(argv[argi], "--stream")) {
+			stream = true;
+		} else if (!strcmp(argv[argi], "-r")) {
+			relocatable = true;
+		} else if (!strcmp(argv[argi], "--map") && argi + 1 < argc) {
+			mapFileStr = argv[++argi];
+		} else if (!strcmp(argv[argi], "--keep") && argi + 1 < argc) {
+			keepLabels[numKeepLabels++] = argv[++argi];
+		} else if (!strcmp(argv[argi], "--objdir") && argi + 1 < argc) {
+			objDirs[numObjDirs++] = argv[++argi];
+		} else if (!strcmp(argv[argi], "--stats")) {
+			stats = true;
+		} else if (!strcmp(argv[argi], "--binary")) {
+			binary = true;
+		} else if (!strcmp(argv[argi], "--parallel-write")) {
+			parallelWrite = true;
+		} else if (!strcmp(argv[argi], "--profile") && argi + 1 < argc) {
+			profileFileStr = argv[++argi];
+		} else if (!strcmp(argv[argi], "--cache") && argi + 1 < argc) {
+			cacheDir = argv[++argi];
+		} else if (!strcmp(argv[argi], "--cache-size") && argi + 1 < argc) {
+			cacheSize = strtoull(argv[++argi], NULL, 10);
+		} else {
+			break;
+		}
+	}
+
+	// Inputs are named directly, listed one per line in @response-files,
+	// or found in --objdir directories, which come after the rest
+	struct InputList inputs = {NULL, 0, 0};
+	for (; argi < argc - 1; argi++) {
+		if (argv[argi][0] == '@') {
+			if (readResponseFile(argv[argi] + 1, &inputs)) {
+				printf("error in opening %s\n", argv[argi] + 1);
+				exit(1);
+			}
+		} else {
+			addInput(&inputs, argv[argi]);
+		}
+	}
+	for (i = 0; i < numObjDirs; i++) {
+		if (addObjectDirectory(objDirs[i], &inputs)) {
+			printf("error in opening %s\n", objDirs[i]);
+			exit(1);
+		}
+	}
+	if (argi >= argc || inputs.count == 0) {
+		printf("error: usage: %s [-r] [--incremental] [--gc [--keep <label>] ...] [--fold-data] [--stream] [--map <map-file>] [--objdir <directory>] [--stats] [--binary] [--parallel-write] [--profile <counts-file>] [--cache <directory> [--cache-size <bytes>]] <MAIN-object-file> ... <object-file> ... [<library-file> ...] [@<response-file> ...] <output-exe-file>\n",
+				argv[0]);
+		exit(1);
+	}
+
+	// Inputs ending in .lib are libraries; only the members needed are linked
+	outFileStr = argv[argc - 1];
+	char **fileNames = allocate(inputs.count, sizeof(char *));
+	char **libraryNames = allocate(inputs.count, sizeof(char *));
+	unsigned int numFiles = 0, numLibraries = 0;
+	for (i = 0; i < inputs.count; i++) {
+		size_t length = strlen(inputs.names[i]);
+		if (length > 4 && !strcmp(inputs.names[i] + length - 4, ".lib")) {
+			libraryNames[numLibraries++] = inputs.names[i];
+		} else {
+			fileNames[numFiles++] = inputs.names[i];
+		}
+	}
+	if (numFiles == 0) {
+		printf("error: no object files to link\n");
+		exit(1);
+	}
+	// -r writes an object file, so only the options about what goes in apply
+	if (relocatable && (incremental || stream || foldData || binary || parallelWrite || mapFileStr
+			|| profileFileStr)) {
+		printf("error: -r can't be used with --incremental, --stream, --fold-data, --binary, --parallel-write, --map or --profile\n");
+		exit(1);
+	}
+	// the profile's addresses are those of a link without --fold-data
+	if (profileFileStr != NULL && foldData) {
+		printf("error: --profile can't be used with --fold-data\n");
+		exit(1);
+	}
+	if (incremental && (numLibraries > 0 || gc || foldData || mapFileStr || profileFileStr)) {
+		printf("incremental: links with libraries, --gc, --fold-data, --map or --profile are always done in full\n");
+		incremental = false;
+	}
+	if (stream && (incremental || foldData)) {
+		printf("stream: not used with --incremental or --fold-data\n");
+		stream = false;
+	}
+	// --stream already writes each object to its place as it goes
+	if (parallelWrite && stream) {
+		printf("parallel-write: not used with --stream\n");
+		parallelWrite = false;
+	}
+
+	// A link of inputs and options seen before is copied from the cache
+	char cacheEntry[40] = "";
+	if (cacheDir != NULL && (incremental || mapFileStr)) {
+		printf("cache: not used with --incremental or --map\n");
+		cacheDir = NULL;
+	}
+	if (cacheDir != NULL) {
+		size_t optionsLength = 32;
+		for (i = 0; i < numKeepLabels; i++) {
+			optionsLength += strlen(keepLabels[i]) + 6;
+		}
+		char *options = allocate(optionsLength, 1);
+		strcpy(options, relocatable ? "relocatable" : binary ? "binary" : "text");
+		if (gc) {
+			strcat(options, " gc");
+			for (i = 0; i < numKeepLabels; i++) {
+				strcat(options, " keep ");
+				strcat(options, keepLabels[i]);
+			}
+		}
+		if (foldData) {
+			strcat(options, " fold");
+		}
+		// objects first, then libraries, as they are linked, then the profile
+		unsigned int numInputs = numFiles + numLibraries;
+		char **inputNames = allocate(numInputs + 1, sizeof(char *));
+		memcpy(inputNames, fileNames, numFiles * sizeof(char *));
+		memcpy(inputNames + numFiles, libraryNames, numLibraries * sizeof(char *));
+		if (profileFileStr != NULL) {
+			strcat(options, " profile");
+			inputNames[numInputs++] = profileFileStr;
+		}
+		struct CacheKey key;
+		if ((mkdir(cacheDir, 0777) == 0 || errno == EEXIST)
+				&& computeCacheKey(&key, inputNames, numInputs, options) == 0) {
+			sprintf(cacheEntry, "%016llx%016llx.exe", key.fnv, key.mixed);
+		}
+		free(inputNames);
+		free(options);
+		if (cacheEntry[0] != '\0') {
+			unsigned long long hits, misses;
+			int hit = lookUpLinkCache(cacheDir, cacheEntry, outFileStr);
+			countCacheLookup(cacheDir, hit, &hits, &misses);
+			printf("cache: %s (%llu hits, %llu misses)\n", hit ? "hit" : "miss", hits, misses);
+			if (hit) {
+				return 0;
+			}
+		}
+	}
+
+	char *stateFileStr = NULL;
+	if (incremental) {
+		stateFileStr = allocate(strlen(outFileStr) + sizeof(".state"), 1);
+		sprintf(stateFileStr, "%s.state", outFileStr);
+		if (incrementalLink(fileNames, numFiles, outFileStr, stateFileStr, binary,
+				parallelWrite)) {
+			free(stateFileStr);
+			return 0;
+		}
+	}
+
+	FileData *files = allocate(numFiles, sizeof(FileData));
+
+	// read in all files and combine into a "master" file
+	// Files are parsed concurrently, each into its own FileData; reporting
+	// is done afterwards in input order so the output stays the same.
+	// Only the headers and tables are kept for now.
+	struct timespec readStart;
+	clock_gettime(CLOCK_MONOTONIC, &readStart);
+	struct ReadContext readContext = {fileNames, files, false};
+	parallelFor(numFiles, 0, readObjectTask, &readContext);
+	double readTime = elapsedMilliseconds(&readStart);
+	unsigned long long bytesRead = 0;
+	for (i = 0; i < numFiles; ++i) {
+		printf("opening %s\n", fileNames[i]);
+		if (files[i].error[0] != '\0') {
+			printf("%s", files[i].error);
+			exit(1);
+		}
+		bytesRead += files[i].fileSize;
+	} // end reading files
+	if (stats) {
+		printf("read %u object files, %llu bytes in %.3f ms (%.1f us per file, %.1f MB/s)\n",
+			numFiles, bytesRead, readTime, readTime * 1e3 / numFiles,
+			readTime > 0 ? bytesRead / readTime / 1e3 : 0.0);
+	}
+
+	// pull in the library members that define undefined labels
+	if (numLibraries > 0) {
+		struct LibrarySet libraries;
+		memset(&libraries, 0, sizeof(libraries));
+		for (i = 0; i < numLibraries; i++) {
+			printf("opening %s\n", libraryNames[i]);
+			if (readLibrary(libraryNames[i], &libraries)) {
+				printf("%s", libraries.error);
+				exit(1);
+			}
+		}
+		indexLibraryExports(&libraries);
+		pullInLibraryMembers(&files, &numFiles, &libraries);
+	}
+
+	// Link. Layout, globals and relocation live in lc2k_link.c, shared with
+	// the library interface; gc drops the objects the program can't reach.
+	// Objects were read without their sections: they are only read for
+	// the objects still in the link once it is laid out, straight into
+	// their place in the combined sections.
+	struct Link link;
+	memset(&link, 0, sizeof(link));
+	link.files = files;
+	link.numFiles = numFiles;
+	lc2k_options options = {.gc = gc, .keepLabels = (const char *const *)keepLabels,
+		.numKeepLabels = numKeepLabels, .foldData = foldData};
+	unsigned long long *profile = NULL;
+	if (profileFileStr != NULL) {
+		int line = readProfile(profileFileStr, &profile, &options.profileSize);
+		if (line < 0) {
+			printf("error in opening %s\n", profileFileStr);
+			exit(1);
+		} else if (line > 0) {
+			printf("error: %s:%d: expected an address and a count\n", profileFileStr, line);
+			exit(1);
+		}
+		options.profile = profile;
+	}
+	lc2k_diag diag;
+	memset(&diag, 0, sizeof(diag));
+	FileData merged;
+	memset(&merged, 0, sizeof(merged));
+	int status;
+	if (relocatable) {
+		struct SectionContext sectionContext = {files, NULL};
+		parallelFor(numFiles, 0, readSectionsTask, &sectionContext);
+		exitOnFileErrors(files, numFiles);
+		status = linkRelocatable(&link, &options, &merged, &diag);
+	} else {
+		status = linkSymbols(&link, &options, &diag);
+	}
+	if (link.collected) {
+		// each word is one 11-byte line of the executable
+		printf("gc: removed %u of %u objects, %u words (%u bytes)\n", link.numFilesRemoved,
+			numFiles, link.wordsRemoved, link.wordsRemoved * 11);
+	}
+	if (profile != NULL && status == 0) {
+		printf("profile: hot text in %u cache lines instead of %u, hot data in %u instead of %u (%u-word lines)\n",
+			link.hotTextLines[1], link.hotTextLines[0], link.hotDataLines[1],
+			link.hotDataLines[0], PROFILELINEWORDS);
+	}
+	if (link.numVeneers > 0) {
+		printf("veneers: %u branches out of range go through veneers, after %u layout passes\n",
+			link.numVeneers, link.layoutPasses);
+	}
+	exitOnDiagnostics(&diag, status);
+	memset(&diag, 0, sizeof(diag));
+	unsigned int numFilesRead = numFiles;
+	files = link.files;
+	numFiles = link.numFiles;
+
+	// --stream reads the sections one object at a time as it writes them
+	if (!relocatable && !stream) {
+		link.combined.text = allocate(link.combined.textSize, sizeof(int));
+		link.combined.data = allocate(link.combined.dataSize, sizeof(int));
+		unsigned long long sectionBytes = 0;
+		unsigned int numLoaded = 0;
+		for (i = 0; i < numFiles; i++) {
+			if (files[i].text == NULL) {
+				sectionBytes += files[i].sectionsEnd - files[i].sectionsOffset;
+				numLoaded++;
+			}
+		}
+		struct timespec sectionStart;
+		clock_gettime(CLOCK_MONOTONIC, &sectionStart);
+		struct SectionContext sectionContext = {files, &link.combined};
+		parallelFor(numFiles, 0, readSectionsTask, &sectionContext);
+		double sectionTime = elapsedMilliseconds(&sectionStart);
+		exitOnFileErrors(files, numFiles);
+		if (stats) {
+			printf("read the sections of %u of %u object files, %llu bytes in %.3f ms\n",
+				numLoaded, numFilesRead, sectionBytes, sectionTime);
+		}
+		status = finishLink(&link, &options, &diag);
+		if (foldData && status == 0) {
+			printf("fold: folded %u identical data runs, %u words (%u bytes)\n", link.runsFolded,
+				link.wordsFolded, link.wordsFolded * 11);
+		}
+		exitOnDiagnostics(&diag, status);
+	}
+
+	// 6) Write out final machine code
+	//    text instructions first, then data, as text or a --binary image
+	//    (--stream writes each object straight to its place instead)
+	//    (-r writes the merged relocatable object instead)
+	if (relocatable ? writeObjectFile(outFileStr, &merged)
+			: stream ? streamExecutable(outFileStr, &link, binary)
+			: writeExecutable(outFileStr, &link.combined, binary, parallelWrite)) {
+		printf("error in opening %s\n", outFileStr);
+		exit(1);
+	}
+	if (cacheEntry[0] != '\0') {
+		storeInLinkCache(cacheDir, cacheEntry, outFileStr, cacheSize);
+	}
+	if (mapFileStr != NULL
+			&& writeLinkMap(mapFileStr, files, numFiles, &link.combined, &link.globals,
+				link.veneers, link.numVeneers)) {
+		printf("error in opening %s\n", mapFileStr);
+		exit(1);
+	}
+	// the state has no room for veneers; without it the next link is full
+	if (incremental && link.numVeneers > 0) {
+		printf("incremental: links with veneers are always done in full\n");
+		remove(stateFileStr);
+	} else if (incremental) {
+		saveFullLinkState(stateFileStr, outFileStr, files, numFiles, &link.combined,
+			&link.globals, &link.relocation);
+	}
+	free(stateFileStr);
+	freeLink(&link);
+	freeFileData(&merged);
+	free(profile);
+	return 0;
 } // main
 
 // Prints a machine code word in the proper hex format to the file
@@ -0,0 +1,156 @@
+/**
+ * Project 2
+ * Test of the lc2k_link library
+ *
+ * Links the object files named on the command line in memory and compares
+ * the program with an expected executable, then links them again on
+ * several threads at once, together with a link that has to fail, to check
+ * that links share no state and report errors instead of exiting. Uses
+ * only lc2k_link.h.
+ *
+ * usage: linktest <expected-exe-file> <MAIN-object-file> ... <object-file> ...
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lc2k_link.h"
+
+#define NUMTHREADS 8
+#define LINKSPERTHREAD 200
+#define MAXWORDS 65536
+
+// An object that refers to a label nothing defines
+static const char undefinedObject[] = "1 0 1 1\n0x00800000\nNope U 0\n0 lw Nope\n";
+
+lc2k_obj *objs;
+size_t numObjs;
+int expected[MAXWORDS];
+unsigned int numExpected = 0;
+
+struct ThreadResult {
+    unsigned int matched;
+    unsigned int failedAsExpected;
+};
+
+// Reads a whole file into memory, exiting if it can't.
+static char *readFile(const char *fileStr, size_t *size) {
+    FILE *filePtr = fopen(fileStr, "rb");
+    if (filePtr == NULL) {
+        printf("error in opening %s\n", fileStr);
+        exit(1);
+    }
+    fseek(filePtr, 0, SEEK_END);
+    long length = ftell(filePtr);
+    fseek(filePtr, 0, SEEK_SET);
+    char *contents = malloc(length > 0 ? length : 1);
+    if (contents == NULL || fread(contents, 1, length, filePtr) != (size_t)length) {
+        printf("error in reading %s\n", fileStr);
+        exit(1);
+    }
+    fclose(filePtr);
+    *size = length;
+    return contents;
+}
+
+// Reads an executable, one word per line.
+static void readExpected(const char *fileStr) {
+    char line[100];
+    FILE *filePtr = fopen(fileStr, "r");
+    if (filePtr == NULL) {
+        printf("error in opening %s\n", fileStr);
+        exit(1);
+    }
+    while (numExpected < MAXWORDS && fgets(line, sizeof(line), filePtr) != NULL) {
+        expected[numExpected++] = (int)strtoul(line, NULL, 0);
+    }
+    fclose(filePtr);
+}
+
+static bool matchesExpected(const lc2k_exe *exe) {
+    if (exe->textSize + exe->dataSize != numExpected) {
+        return false;
+    }
+    return memcmp(exe->text, expected, exe->textSize * sizeof(int)) == 0
+        && memcmp(exe->data, expected + exe->textSize, exe->dataSize * sizeof(int)) == 0;
+}
+
+// Links the objects and the undefined-label object in turn, with both
+// entry points, counting the results that come out as they should.
+static void *linkWorker(void *arg) {
+    struct ThreadResult *result = arg;
+    lc2k_obj bad[1] = {{.name = "undefined.obj", .contents = undefinedObject,
+        .size = sizeof(undefinedObject) - 1}};
+    lc2k_options options = {.threads = 1};
+    for (unsigned int i = 0; i < LINKSPERTHREAD; i++) {
+        lc2k_exe exe;
+        lc2k_diag diag;
+        int status = i % 2 ? lc2k_link_with(objs, numObjs, &options, &exe, &diag)
+            : lc2k_link(objs, numObjs, &exe, &diag);
+        if (status == 0 && matchesExpected(&exe)) {
+            result->matched++;
+        }
+        if (status == 0) {
+            lc2k_exe_free(&exe);
+        }
+        if (lc2k_link(bad, 1, &exe, &diag) == -1 && diag.numErrors == 1
+                && strstr(diag.message, "error: undefined label 'Nope'") != NULL) {
+            result->failedAsExpected++;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("error: usage: %s <expected-exe-file> <MAIN-object-file> ... <object-file> ...\n",
+            argv[0]);
+        exit(1);
+    }
+    readExpected(argv[1]);
+    numObjs = argc - 2;
+    objs = calloc(numObjs, sizeof(lc2k_obj));
+    if (objs == NULL) {
+        printf("error: out of memory\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < numObjs; i++) {
+        objs[i].name = argv[i + 2];
+        objs[i].contents = readFile(argv[i + 2], &objs[i].size);
+    }
+
+    lc2k_exe exe;
+    lc2k_diag diag;
+    if (lc2k_link(objs, numObjs, &exe, &diag)) {
+        printf("link failed:\n%s", diag.message);
+        exit(1);
+    }
+    printf("link: %s\n", matchesExpected(&exe) ? "matches" : "differs");
+    lc2k_exe_free(&exe);
+
+    pthread_t threads[NUMTHREADS];
+    struct ThreadResult results[NUMTHREADS];
+    memset(results, 0, sizeof(results));
+    for (int i = 0; i < NUMTHREADS; i++) {
+        if (pthread_create(&threads[i], NULL, linkWorker, &results[i]) != 0) {
+            printf("error: could not start a thread\n");
+            exit(1);
+        }
+    }
+    unsigned int matched = 0, failedAsExpected = 0;
+    for (int i = 0; i < NUMTHREADS; i++) {
+        pthread_join(threads[i], NULL);
+        matched += results[i].matched;
+        failedAsExpected += results[i].failedAsExpected;
+    }
+    printf("threads: %u of %u links matched, %u of %u bad links reported an error\n",
+        matched, NUMTHREADS * LINKSPERTHREAD, failedAsExpected, NUMTHREADS * LINKSPERTHREAD);
+
+    for (size_t i = 0; i < numObjs; i++) {
+        free((char *)objs[i].contents);
+    }
+    free(objs);
+    return 0;
+}